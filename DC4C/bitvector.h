@@ -0,0 +1,535 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_bitvector_h
+#define __DC4C_bitvector_h
+
+#if __STDC_VERSION__ < 202311L
+# include <stdbool.h>
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** The amount of bits stored in one word of a bit vector. */
+#define __DC4C_BITVECTOR_WORD_BITS 64
+
+/**
+ * Returns the amount of words needed to store the given amount of bits.
+ *
+ * @param bits the amount of bits
+ * @return the amount of words needed
+ */
+#define __dc4c_bitvector_words(bits) (((size_t) (bits) + __DC4C_BITVECTOR_WORD_BITS - 1) / __DC4C_BITVECTOR_WORD_BITS)
+
+/**
+ * Returns the mask selecting the given bit within its word.
+ *
+ * @param index the index of the bit
+ * @return the mask of the bit
+ */
+#define __dc4c_bitvector_mask(index) (UINT64_C(1) << ((size_t) (index) % __DC4C_BITVECTOR_WORD_BITS))
+
+/**
+ * @brief The bit vector structure.
+ *
+ * The bits are packed into 64 bit words. All bits of the last word that lie
+ * behind the last stored bit are always zero.
+ */
+struct bitvector {
+    /** The amount of stored bits.                    */
+    size_t    count;
+    /** The amount of bits the vector is able to hold. */
+    size_t    cap;
+    /** The words holding the bits.                   */
+    uint64_t* content;
+};
+
+typedef struct bitvector bitvector_t;
+
+/** The initial values for a bit vector. */
+#define bitvector_initializer { 0, 0, NULL }
+
+/**
+ * Initializes the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ */
+#define bitvector_init(bitvectorPtr)         \
+do {                                         \
+    bitvector_t* __bv_bvin = (bitvectorPtr); \
+                                             \
+    __bv_bvin->count   = 0;                  \
+    __bv_bvin->cap     = 0;                  \
+    __bv_bvin->content = NULL;               \
+} while (0)
+
+/**
+ * @brief Allocates enough storage for the given bit vector to hold at least
+ * the given amount of bits.
+ *
+ * If the allocation failed, the content of the given bit vector is left
+ * unchanged.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param newSize the amount of bits the bit vector should be able to hold
+ * @return whether the bit vector holds enough memory
+ */
+#define bitvector_reserve(bitvectorPtr, newSize) ({                                      \
+    bool __bvr_result = false;                                                           \
+    do {                                                                                 \
+        bitvector_t* __bv_bvr = (bitvectorPtr);                                          \
+        size_t       __n_bvr  = (size_t) (newSize);                                      \
+        size_t       __w_bvr  = __dc4c_bitvector_words(__n_bvr);                         \
+                                                                                         \
+        if (__bv_bvr->cap >= __n_bvr) {                                                  \
+            __bvr_result = true;                                                         \
+            break;                                                                       \
+        }                                                                                \
+                                                                                         \
+        uint64_t* __bvr_tmp = (uint64_t*) realloc(__bv_bvr->content,                     \
+                                                  sizeof(*__bv_bvr->content) * __w_bvr); \
+        if (__bvr_tmp == NULL) {                                                         \
+            break;                                                                       \
+        }                                                                                \
+                                                                                         \
+        __bv_bvr->content = __bvr_tmp;                                                   \
+        __bv_bvr->cap     = __w_bvr * __DC4C_BITVECTOR_WORD_BITS;                        \
+        __bvr_result = true;                                                             \
+    } while (0);                                                                         \
+    __bvr_result;                                                                        \
+})
+
+/**
+ * @brief Adds the given bit at the end of the given bit vector.
+ *
+ * If the allocation failed, the content of the given bit vector is left
+ * unchanged.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param value the bit to be added
+ * @return whether the bit was added successfully
+ */
+#define bitvector_push_back(bitvectorPtr, value) ({                                            \
+    bool __bvpb_result = false;                                                                \
+    do {                                                                                       \
+        bitvector_t* __bv_bvpb  = (bitvectorPtr);                                              \
+        bool         __vl_bvpb = (value);                                                      \
+                                                                                               \
+        if (__bv_bvpb->cap < __bv_bvpb->count + 1) {                                           \
+            if (!bitvector_reserve(__bv_bvpb, __bv_bvpb->cap == 0 ? __DC4C_BITVECTOR_WORD_BITS \
+                                                                  : __bv_bvpb->cap * 2)) {     \
+                break;                                                                         \
+            }                                                                                  \
+        }                                                                                      \
+                                                                                               \
+        if (__bv_bvpb->count % __DC4C_BITVECTOR_WORD_BITS == 0) {                              \
+            __bv_bvpb->content[__bv_bvpb->count / __DC4C_BITVECTOR_WORD_BITS] = 0;             \
+        }                                                                                      \
+        if (__vl_bvpb) {                                                                       \
+            __bv_bvpb->content[__bv_bvpb->count / __DC4C_BITVECTOR_WORD_BITS] |=               \
+                __dc4c_bitvector_mask(__bv_bvpb->count);                                       \
+        }                                                                                      \
+        ++__bv_bvpb->count;                                                                    \
+        __bvpb_result = true;                                                                  \
+    } while (0);                                                                               \
+    __bvpb_result;                                                                             \
+})
+
+/**
+ * Removes the last bit of the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @return the removed bit
+ */
+#define bitvector_pop_back(bitvectorPtr) ({                                                    \
+    bitvector_t* __bv_bvpopb = (bitvectorPtr);                                                 \
+    size_t       __i_bvpopb  = --__bv_bvpopb->count;                                           \
+    uint64_t*    __w_bvpopb  = &__bv_bvpopb->content[__i_bvpopb / __DC4C_BITVECTOR_WORD_BITS]; \
+                                                                                               \
+    bool __bvpopb_toReturn = (*__w_bvpopb & __dc4c_bitvector_mask(__i_bvpopb)) != 0;           \
+    *__w_bvpopb &= ~__dc4c_bitvector_mask(__i_bvpopb);                                         \
+    __bvpopb_toReturn;                                                                         \
+})
+
+/**
+ * @brief Resizes the given bit vector to hold the given amount of bits.
+ *
+ * Newly added bits are set to the given value. If the allocation failed, the
+ * content of the given bit vector is left unchanged.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param newSize the new amount of bits
+ * @param value the value of newly added bits
+ * @return whether the bit vector was resized successfully
+ */
+#define bitvector_resize(bitvectorPtr, newSize, value) ({                                                     \
+    bool __bvrs_result = false;                                                                               \
+    do {                                                                                                      \
+        bitvector_t* __bv_bvrs = (bitvectorPtr);                                                              \
+        size_t       __s_bvrs  = (size_t) (newSize);                                                          \
+        bool         __vl_bvrs = (value);                                                                     \
+                                                                                                              \
+        if (!bitvector_reserve(__bv_bvrs, __s_bvrs)) {                                                        \
+            break;                                                                                            \
+        }                                                                                                     \
+                                                                                                              \
+        if (__s_bvrs > __bv_bvrs->count) {                                                                    \
+            size_t __f_bvrs = __dc4c_bitvector_words(__bv_bvrs->count);                                       \
+            if (__bv_bvrs->count % __DC4C_BITVECTOR_WORD_BITS != 0 && __vl_bvrs) {                            \
+                __bv_bvrs->content[__f_bvrs - 1] |= ~(__dc4c_bitvector_mask(__bv_bvrs->count) - 1);           \
+            }                                                                                                 \
+            memset(&__bv_bvrs->content[__f_bvrs], __vl_bvrs ? 0xff : 0,                                       \
+                   (__dc4c_bitvector_words(__s_bvrs) - __f_bvrs) * sizeof(*__bv_bvrs->content));              \
+        }                                                                                                     \
+        __bv_bvrs->count = __s_bvrs;                                                                          \
+        if (__s_bvrs % __DC4C_BITVECTOR_WORD_BITS != 0) {                                                     \
+            __bv_bvrs->content[__s_bvrs / __DC4C_BITVECTOR_WORD_BITS] &= __dc4c_bitvector_mask(__s_bvrs) - 1; \
+        }                                                                                                     \
+        __bvrs_result = true;                                                                                 \
+    } while (0);                                                                                              \
+    __bvrs_result;                                                                                            \
+})
+
+/**
+ * Removes all bits of the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ */
+#define bitvector_clear(bitvectorPtr) \
+do {                                  \
+    (bitvectorPtr)->count = 0;        \
+} while (0)
+
+/**
+ * @brief Returns the bit at the given position.
+ *
+ * The given position must be in the range [0 ... size - 1].
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param position the position of the bit
+ * @return whether the bit is set
+ */
+#define bitvector_test(bitvectorPtr, position) ({                                                          \
+    size_t __p_bvt = (size_t) (position);                                                                  \
+    ((bitvectorPtr)->content[__p_bvt / __DC4C_BITVECTOR_WORD_BITS] & __dc4c_bitvector_mask(__p_bvt)) != 0; \
+})
+
+/**
+ * @brief Sets the bit at the given position to the given value.
+ *
+ * The given position must be in the range [0 ... size - 1].
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param position the position of the bit
+ * @param value the new value of the bit
+ */
+#define bitvector_set(bitvectorPtr, position, value)                                  \
+do {                                                                                  \
+    bitvector_t* __bv_bvs = (bitvectorPtr);                                           \
+    size_t       __p_bvs  = (size_t) (position);                                      \
+    uint64_t*    __w_bvs  = &__bv_bvs->content[__p_bvs / __DC4C_BITVECTOR_WORD_BITS]; \
+                                                                                      \
+    if (value) {                                                                      \
+        *__w_bvs |= __dc4c_bitvector_mask(__p_bvs);                                   \
+    } else {                                                                          \
+        *__w_bvs &= ~__dc4c_bitvector_mask(__p_bvs);                                  \
+    }                                                                                 \
+} while (0)
+
+/**
+ * @brief Flips the bit at the given position.
+ *
+ * The given position must be in the range [0 ... size - 1].
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param position the position of the bit
+ */
+#define bitvector_flip(bitvectorPtr, position)                                                       \
+do {                                                                                                 \
+    size_t __p_bvf = (size_t) (position);                                                            \
+    (bitvectorPtr)->content[__p_bvf / __DC4C_BITVECTOR_WORD_BITS] ^= __dc4c_bitvector_mask(__p_bvf); \
+} while (0)
+
+/**
+ * Applies the given operator word by word to the two given bit vectors and
+ * stores the result in the first one.
+ *
+ * @param lhsPtr the pointer to the target bit vector
+ * @param rhsPtr the pointer to the other bit vector
+ * @param op the compound assignment operator to apply
+ */
+#define __dc4c_bitvector_bulk(lhsPtr, rhsPtr, op)                       \
+do {                                                                    \
+    bitvector_t*       __bv_l_bvb = (lhsPtr);                           \
+    const bitvector_t* __bv_r_bvb = (rhsPtr);                           \
+                                                                        \
+    const size_t __n_bvb = __dc4c_bitvector_words(__bv_l_bvb->count);   \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_bvb; ++__dc4c_i) {         \
+        __bv_l_bvb->content[__dc4c_i] op __bv_r_bvb->content[__dc4c_i]; \
+    }                                                                   \
+} while (0)
+
+/**
+ * @brief Performs a bitwise and of the two given bit vectors.
+ *
+ * The result is stored in the first bit vector. Both bit vectors must have the
+ * same size.
+ *
+ * @param lhsPtr the pointer to the target bit vector
+ * @param rhsPtr the pointer to the other bit vector
+ */
+#define bitvector_and(lhsPtr, rhsPtr) __dc4c_bitvector_bulk(lhsPtr, rhsPtr, &=)
+
+/**
+ * @brief Performs a bitwise or of the two given bit vectors.
+ *
+ * The result is stored in the first bit vector. Both bit vectors must have the
+ * same size.
+ *
+ * @param lhsPtr the pointer to the target bit vector
+ * @param rhsPtr the pointer to the other bit vector
+ */
+#define bitvector_or(lhsPtr, rhsPtr) __dc4c_bitvector_bulk(lhsPtr, rhsPtr, |=)
+
+/**
+ * @brief Performs a bitwise exclusive or of the two given bit vectors.
+ *
+ * The result is stored in the first bit vector. Both bit vectors must have the
+ * same size.
+ *
+ * @param lhsPtr the pointer to the target bit vector
+ * @param rhsPtr the pointer to the other bit vector
+ */
+#define bitvector_xor(lhsPtr, rhsPtr) __dc4c_bitvector_bulk(lhsPtr, rhsPtr, ^=)
+
+/**
+ * Flips all bits of the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ */
+#define bitvector_not(bitvectorPtr)                                                   \
+do {                                                                                  \
+    bitvector_t* __bv_bvn = (bitvectorPtr);                                           \
+                                                                                      \
+    const size_t __n_bvn = __dc4c_bitvector_words(__bv_bvn->count);                   \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_bvn; ++__dc4c_i) {                       \
+        __bv_bvn->content[__dc4c_i] = ~__bv_bvn->content[__dc4c_i];                   \
+    }                                                                                 \
+    if (__bv_bvn->count % __DC4C_BITVECTOR_WORD_BITS != 0) {                          \
+        __bv_bvn->content[__n_bvn - 1] &= __dc4c_bitvector_mask(__bv_bvn->count) - 1; \
+    }                                                                                 \
+} while (0)
+
+/**
+ * Returns the amount of bits set in the given word.
+ *
+ * @param word the word
+ * @return the amount of set bits
+ */
+#define __dc4c_bitvector_popcount_word(word) ((size_t) __builtin_popcountll((unsigned long long) (word)))
+
+/**
+ * Counts the set bits of the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @return the amount of set bits
+ */
+#define bitvector_popcount(bitvectorPtr) ({                                              \
+    const bitvector_t* __bv_bvpc = (bitvectorPtr);                                       \
+                                                                                         \
+    size_t __bvpc_toReturn = 0;                                                          \
+    const size_t __n_bvpc = __dc4c_bitvector_words(__bv_bvpc->count);                    \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_bvpc; ++__dc4c_i) {                         \
+        __bvpc_toReturn += __dc4c_bitvector_popcount_word(__bv_bvpc->content[__dc4c_i]); \
+    }                                                                                    \
+    __bvpc_toReturn;                                                                     \
+})
+
+/**
+ * @brief Searches the first set bit at or after the given position.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param position the position to start searching at
+ * @return the position of the found bit or the size of the bit vector if none was found
+ */
+#define bitvector_find_next_set(bitvectorPtr, position) ({                                             \
+    const bitvector_t* __bv_bvfn = (bitvectorPtr);                                                     \
+    size_t             __p_bvfn  = (size_t) (position);                                                \
+                                                                                                       \
+    size_t __bvfn_toReturn = __bv_bvfn->count;                                                         \
+    if (__p_bvfn < __bv_bvfn->count) {                                                                 \
+        const size_t __n_bvfn = __dc4c_bitvector_words(__bv_bvfn->count);                              \
+        size_t       __w_bvfn = __p_bvfn / __DC4C_BITVECTOR_WORD_BITS;                                 \
+        uint64_t     __c_bvfn = __bv_bvfn->content[__w_bvfn] & ~(__dc4c_bitvector_mask(__p_bvfn) - 1); \
+        while (__c_bvfn == 0 && ++__w_bvfn < __n_bvfn) {                                               \
+            __c_bvfn = __bv_bvfn->content[__w_bvfn];                                                   \
+        }                                                                                              \
+        if (__c_bvfn != 0) {                                                                           \
+            __bvfn_toReturn = __w_bvfn * __DC4C_BITVECTOR_WORD_BITS                                    \
+                            + (size_t) __builtin_ctzll((unsigned long long) __c_bvfn);                 \
+        }                                                                                              \
+    }                                                                                                  \
+    __bvfn_toReturn;                                                                                   \
+})
+
+/**
+ * Searches the first set bit of the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @return the position of the first set bit or the size of the bit vector if no bit is set
+ */
+#define bitvector_find_first_set(bitvectorPtr) bitvector_find_next_set(bitvectorPtr, 0)
+
+/**
+ * @brief Counts the set bits in front of the given position.
+ *
+ * The given position must be in the range [0 ... size].
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param position the position up to which (exclusively) to count the set bits
+ * @return the amount of set bits in the range [0 ... position - 1]
+ */
+#define bitvector_rank(bitvectorPtr, position) ({                                                   \
+    const bitvector_t* __bv_bvrk = (bitvectorPtr);                                                  \
+    size_t             __p_bvrk  = (size_t) (position);                                             \
+                                                                                                    \
+    size_t __bvrk_toReturn = 0;                                                                     \
+    const size_t __n_bvrk = __p_bvrk / __DC4C_BITVECTOR_WORD_BITS;                                  \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_bvrk; ++__dc4c_i) {                                    \
+        __bvrk_toReturn += __dc4c_bitvector_popcount_word(__bv_bvrk->content[__dc4c_i]);            \
+    }                                                                                               \
+    if (__p_bvrk % __DC4C_BITVECTOR_WORD_BITS != 0) {                                               \
+        __bvrk_toReturn += __dc4c_bitvector_popcount_word(__bv_bvrk->content[__n_bvrk]              \
+                                                          & (__dc4c_bitvector_mask(__p_bvrk) - 1)); \
+    }                                                                                               \
+    __bvrk_toReturn;                                                                                \
+})
+
+/**
+ * @brief Searches the position of the set bit of the given rank.
+ *
+ * The rank is zero based, selecting the rank zero returns the position of the
+ * first set bit.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param rank the amount of set bits in front of the searched one
+ * @return the position of the found bit or the size of the bit vector if there are not enough set bits
+ */
+#define bitvector_select(bitvectorPtr, rank) ({                                    \
+    const bitvector_t* __bv_bvsl = (bitvectorPtr);                                 \
+    size_t             __r_bvsl  = (size_t) (rank);                                \
+                                                                                   \
+    size_t __bvsl_toReturn = __bv_bvsl->count;                                     \
+    const size_t __n_bvsl = __dc4c_bitvector_words(__bv_bvsl->count);              \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_bvsl; ++__dc4c_i) {                   \
+        uint64_t __c_bvsl = __bv_bvsl->content[__dc4c_i];                          \
+        size_t   __pc_bvsl = __dc4c_bitvector_popcount_word(__c_bvsl);             \
+        if (__r_bvsl >= __pc_bvsl) {                                               \
+            __r_bvsl -= __pc_bvsl;                                                 \
+            continue;                                                              \
+        }                                                                          \
+        for (; __r_bvsl > 0; --__r_bvsl) {                                         \
+            __c_bvsl &= __c_bvsl - 1;                                              \
+        }                                                                          \
+        __bvsl_toReturn = __dc4c_i * __DC4C_BITVECTOR_WORD_BITS                    \
+                        + (size_t) __builtin_ctzll((unsigned long long) __c_bvsl); \
+        break;                                                                     \
+    }                                                                              \
+    __bvsl_toReturn;                                                               \
+})
+
+/**
+ * Iterates over the positions of the set bits of the given bit vector in
+ * ascending order and executes the given block of code for each of them.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @param varname the name of the iteration variable holding the position
+ * @param block the code to execute for each set bit
+ */
+#define bitvector_forEachSet(bitvectorPtr, varname, block)                                                \
+do {                                                                                                      \
+    const bitvector_t* __bv_bvfe = (bitvectorPtr);                                                        \
+                                                                                                          \
+    const size_t __n_bvfe = __dc4c_bitvector_words(__bv_bvfe->count);                                     \
+    for (size_t __dc4c_w = 0; __dc4c_w < __n_bvfe; ++__dc4c_w) {                                          \
+        for (uint64_t __c_bvfe = __bv_bvfe->content[__dc4c_w]; __c_bvfe != 0; __c_bvfe &= __c_bvfe - 1) { \
+            const size_t varname = __dc4c_w * __DC4C_BITVECTOR_WORD_BITS                                  \
+                                 + (size_t) __builtin_ctzll((unsigned long long) __c_bvfe);               \
+            { block }                                                                                     \
+        }                                                                                                 \
+    }                                                                                                     \
+} while (0)
+
+/**
+ * Returns the amount of bits held by the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @return the amount of bits in the given bit vector
+ */
+#define bitvector_size(bitvectorPtr) ({ (bitvectorPtr)->count; })
+
+/**
+ * Returns the amount of bits the given bit vector is currently capable to hold.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @return the amount of bits the given bit vector can hold
+ */
+#define bitvector_capacity(bitvectorPtr) ({ (bitvectorPtr)->cap; })
+
+/**
+ * Returns the underlying words of the given bit vector.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ * @return the underlying words of the given bit vector
+ */
+#define bitvector_data(bitvectorPtr) ({ (bitvectorPtr)->content; })
+
+/**
+ * Copies the given bit vector into the given bit vector.
+ *
+ * @param lhsPtr the pointer to the target bit vector
+ * @param rhsPtr the pointer to the bit vector to be copied
+ */
+#define bitvector_copy(lhsPtr, rhsPtr)                                                \
+do {                                                                                  \
+    bitvector_t*       __bv_l_bvc = (lhsPtr);                                         \
+    const bitvector_t* __bv_r_bvc = (rhsPtr);                                         \
+                                                                                      \
+    bitvector_init(__bv_l_bvc);                                                       \
+    bitvector_reserve(__bv_l_bvc, __bv_r_bvc->cap);                                   \
+    memcpy(__bv_l_bvc->content, __bv_r_bvc->content,                                  \
+           __dc4c_bitvector_words(__bv_r_bvc->count) * sizeof(*__bv_l_bvc->content)); \
+    __bv_l_bvc->count = __bv_r_bvc->count;                                            \
+} while (0)
+
+/**
+ * @brief Destroys the given bit vector.
+ *
+ * The destroyed bit vector must be reconstructed before being used again.
+ *
+ * @param bitvectorPtr the pointer to the bit vector
+ */
+#define bitvector_destroy(bitvectorPtr) \
+do {                                    \
+    free((bitvectorPtr)->content);      \
+} while (0)
+
+#ifdef __cplusplus
+# include "bitvector.hpp"
+#endif
+
+#endif /* __DC4C_bitvector_h */
@@ -0,0 +1,341 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_bitvector_h
+# warning Wrong inclusion of "bitvector.hpp" redirected to #include "bitvector.h"!
+# include "bitvector.h"
+#else
+# ifndef __DC4C_bitvector_hpp
+# define __DC4C_bitvector_hpp
+
+# include <new>
+# include <vector>
+
+namespace dc4c {
+/**
+ * This class acts as a RAII compatible wrapper class for the C bit vector of
+ * DC4C.
+ */
+class bitvector {
+    /** The underlying C bit vector. */
+    bitvector_t underlying;
+
+public:
+    /** The type used for the size of the bit vector. */
+    using size_type = std::size_t;
+
+    inline bitvector(): underlying(bitvector_initializer) {}
+
+    inline bitvector(const bitvector& other) {
+        bitvector_copy(&underlying, &other.underlying);
+    }
+
+    inline bitvector(bitvector&& other) noexcept: underlying(other.underlying) {
+        bitvector_init(&other.underlying);
+    }
+
+    /**
+     * Constructs a wrapper bit vector from the given C bit vector.
+     *
+     * @param cVector the C bit vector to be copied into this wrapper
+     */
+    inline bitvector(const bitvector_t& cVector) {
+        bitvector_copy(&underlying, &cVector);
+    }
+
+    /**
+     * Constructs a DC4C bit vector from the given C++ @c std::vector<bool> .
+     *
+     * @param other the C++ standard bit vector to be copied
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline bitvector(const std::vector<bool>& other): underlying(bitvector_initializer) {
+        reserve(other.size());
+
+        for (const bool bit : other) {
+            push_back(bit);
+        }
+    }
+
+    inline ~bitvector() {
+        bitvector_destroy(&underlying);
+    }
+
+    inline auto operator=(const bitvector& other) -> bitvector& {
+        bitvector_destroy(&underlying);
+        bitvector_copy(&underlying, &other.underlying);
+        return *this;
+    }
+
+    inline auto operator=(bitvector&& other) noexcept -> bitvector& {
+        bitvector_destroy(&underlying);
+        underlying = other.underlying;
+        bitvector_init(&other.underlying);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the underlying C bit vector.
+     *
+     * It is safe to manipulate the returned DC4C C bit vector.
+     *
+     * @return the underlying C bit vector
+     */
+    inline auto data() -> bitvector_t& {
+        return underlying;
+    }
+
+    /**
+     * @brief Returns the underlying C bit vector.
+     *
+     * @return the underlying C bit vector
+     */
+    constexpr inline auto data() const -> const bitvector_t& {
+        return underlying;
+    }
+
+    inline operator std::vector<bool>() const {
+        auto toReturn = std::vector<bool>(size());
+        bitvector_forEachSet(&underlying, position, {
+            toReturn[position] = true;
+        });
+        return toReturn;
+    }
+
+    inline operator bitvector_t*() {
+        return &underlying;
+    }
+
+    constexpr inline operator const bitvector_t*() const {
+        return &underlying;
+    }
+
+    /**
+     * @brief Returns the bit at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     * @return whether the bit at the given position is set
+     */
+    inline auto operator[](size_type position) const noexcept -> bool {
+        return bitvector_test(&underlying, position);
+    }
+
+    /**
+     * @brief Returns the bit at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     * @return whether the bit at the given position is set
+     */
+    inline auto test(size_type position) const noexcept -> bool {
+        return bitvector_test(&underlying, position);
+    }
+
+    /**
+     * @brief Sets the bit at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     * @param value the new value of the bit
+     */
+    inline void set(size_type position, bool value = true) noexcept {
+        bitvector_set(&underlying, position, value);
+    }
+
+    /**
+     * @brief Flips the bit at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     */
+    inline void flip(size_type position) noexcept {
+        bitvector_flip(&underlying, position);
+    }
+
+    /**
+     * Adds the given bit at the end of the bit vector.
+     *
+     * @param value the bit to be stored
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void push_back(bool value) {
+        if (!bitvector_push_back(&underlying, value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Removes the last bit stored in this container.
+     *
+     * @return the removed bit
+     */
+    inline auto pop_back() -> bool {
+        return bitvector_pop_back(&underlying);
+    }
+
+    /**
+     * Resizes the bit vector to hold the given amount of bits.
+     *
+     * @param newSize the new amount of bits
+     * @param value the value of newly added bits
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void resize(size_type newSize, bool value = false) {
+        if (!bitvector_resize(&underlying, newSize, value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Reserves enough storage to hold the given amount of bits.
+     *
+     * @param newCap the amount of bits the bit vector should be able to store
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void reserve(size_type newCap) {
+        if (!bitvector_reserve(&underlying, newCap)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Removes all bits stored in this bit vector.
+     */
+    inline void clear() noexcept {
+        bitvector_clear(&underlying);
+    }
+
+    /**
+     * Returns the amount of bits currently held by this bit vector.
+     *
+     * @return the amount of bits currently held
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.count;
+    }
+
+    /**
+     * Returns the amount of bits this bit vector is currently capable to hold.
+     *
+     * @return the amount of bits this bit vector currently can hold
+     */
+    constexpr inline auto capacity() const noexcept -> size_type {
+        return underlying.cap;
+    }
+
+    /**
+     * Counts the set bits of this bit vector.
+     *
+     * @return the amount of set bits
+     */
+    inline auto popcount() const noexcept -> size_type {
+        return bitvector_popcount(&underlying);
+    }
+
+    /**
+     * Searches the first set bit.
+     *
+     * @return the position of the first set bit or the size if no bit is set
+     */
+    inline auto find_first_set() const noexcept -> size_type {
+        return bitvector_find_first_set(&underlying);
+    }
+
+    /**
+     * Searches the first set bit at or after the given position.
+     *
+     * @param position the position to start searching at
+     * @return the position of the found bit or the size if none was found
+     */
+    inline auto find_next_set(size_type position) const noexcept -> size_type {
+        return bitvector_find_next_set(&underlying, position);
+    }
+
+    /**
+     * Counts the set bits in front of the given position.
+     *
+     * @param position the position up to which (exclusively) to count
+     * @return the amount of set bits in front of the given position
+     */
+    inline auto rank(size_type position) const noexcept -> size_type {
+        return bitvector_rank(&underlying, position);
+    }
+
+    /**
+     * Searches the position of the set bit of the given zero based rank.
+     *
+     * @param rank the amount of set bits in front of the searched one
+     * @return the position of the found bit or the size if there are not enough set bits
+     */
+    inline auto select(size_type rank) const noexcept -> size_type {
+        return bitvector_select(&underlying, rank);
+    }
+
+    /**
+     * Performs a bitwise and with the given bit vector of the same size.
+     *
+     * @param other the other bit vector
+     * @return @c *this
+     */
+    inline auto operator&=(const bitvector& other) noexcept -> bitvector& {
+        bitvector_and(&underlying, &other.underlying);
+        return *this;
+    }
+
+    /**
+     * Performs a bitwise or with the given bit vector of the same size.
+     *
+     * @param other the other bit vector
+     * @return @c *this
+     */
+    inline auto operator|=(const bitvector& other) noexcept -> bitvector& {
+        bitvector_or(&underlying, &other.underlying);
+        return *this;
+    }
+
+    /**
+     * Performs a bitwise exclusive or with the given bit vector of the same size.
+     *
+     * @param other the other bit vector
+     * @return @c *this
+     */
+    inline auto operator^=(const bitvector& other) noexcept -> bitvector& {
+        bitvector_xor(&underlying, &other.underlying);
+        return *this;
+    }
+
+    /**
+     * Flips all bits of this bit vector.
+     *
+     * @return @c *this
+     */
+    inline auto flip() noexcept -> bitvector& {
+        bitvector_not(&underlying);
+        return *this;
+    }
+};
+}
+
+# endif /* __DC4C_bitvector_hpp */
+#endif /* !__DC4C_bitvector_h */
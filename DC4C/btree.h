@@ -0,0 +1,580 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_btree_h
+#define __DC4C_btree_h
+
+#include "pair.h"
+#include "vector.h"
+
+/**
+ * The maximum amount of keys of each node in the B+trees. Can be defined
+ * before including this header.
+ */
+#ifndef DC4C_BTREE_ORDER
+# define DC4C_BTREE_ORDER 64
+#endif
+
+#if DC4C_BTREE_ORDER < 4
+# error The order of the B+trees needs to be at least 4.
+#endif
+
+/** The maximum height of a B+tree, never reached by trees fitting into memory. */
+#define __DC4C_BTREE_MAX_HEIGHT 64
+
+/**
+ * @brief Defines the structures of the B+tree.
+ *
+ * The keys and values of a leaf are stored in separate arrays, so searching a
+ * node only touches the keys. The leaves are linked in ascending order.
+ *
+ * @param name the name of the B+tree
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ */
+#define __dc4c_btree_named(name, keyType, valueType)    \
+struct btree_leaf_##name {                              \
+    size_t                    count;                    \
+    struct btree_leaf_##name* next;                     \
+    keyType                   keys[DC4C_BTREE_ORDER];   \
+    valueType                 values[DC4C_BTREE_ORDER]; \
+};                                                      \
+                                                        \
+struct btree_inner_##name {                             \
+    size_t  count;                                      \
+    keyType keys[DC4C_BTREE_ORDER];                     \
+    void*   children[DC4C_BTREE_ORDER + 1];             \
+};                                                      \
+                                                        \
+struct btree_iterator_##name {                          \
+    struct btree_leaf_##name* leaf;                     \
+    size_t                    position;                 \
+};                                                      \
+                                                        \
+struct btree_##name {                                   \
+    size_t                    count;                    \
+    size_t                    height;                   \
+    void*                     root;                     \
+    struct btree_leaf_##name* first;                    \
+}
+
+/**
+ * @brief Defines the functions of the B+tree.
+ *
+ * The given comparison function is called with two pointers to the key type,
+ * the same way as the comparison function of @c vector_sort . It is called
+ * directly, allowing the compiler to inline it. The nodes are searched
+ * linearly without branching on the comparison, so the search of a node
+ * vectorizes for keys whose comparison compiles to plain instructions.
+ *
+ * @param name the name of the B+tree
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ * @param comp the comparison function
+ */
+#define __dc4c_btree_methods(name, keyType, valueType, comp)                                                           \
+static inline size_t __dc4c_btree_lower_bound_##name(const keyType* keys, size_t count, const keyType* key) {          \
+    size_t toReturn = 0;                                                                                               \
+    for (size_t i = 0; i < count; ++i) {                                                                               \
+        toReturn += comp(&keys[i], key) < 0;                                                                           \
+    }                                                                                                                  \
+    return toReturn;                                                                                                   \
+}                                                                                                                      \
+                                                                                                                       \
+static inline size_t __dc4c_btree_upper_bound_##name(const keyType* keys, size_t count, const keyType* key) {          \
+    size_t toReturn = 0;                                                                                               \
+    for (size_t i = 0; i < count; ++i) {                                                                               \
+        toReturn += comp(&keys[i], key) <= 0;                                                                          \
+    }                                                                                                                  \
+    return toReturn;                                                                                                   \
+}                                                                                                                      \
+                                                                                                                       \
+static inline struct btree_leaf_##name* __dc4c_btree_leaf_of_##name(const struct btree_##name* self,                   \
+                                                                    const keyType* key) {                              \
+    void* node = self->root;                                                                                           \
+    for (size_t level = self->height; level > 1; --level) {                                                            \
+        const struct btree_inner_##name* inner = (const struct btree_inner_##name*) node;                              \
+        node = inner->children[__dc4c_btree_upper_bound_##name(inner->keys, inner->count, key)];                       \
+    }                                                                                                                  \
+    return (struct btree_leaf_##name*) node;                                                                           \
+}                                                                                                                      \
+                                                                                                                       \
+static inline void __dc4c_btree_free_##name(void* node, size_t height) {                                               \
+    if (height > 1) {                                                                                                  \
+        struct btree_inner_##name* inner = (struct btree_inner_##name*) node;                                          \
+        for (size_t i = 0; i <= inner->count; ++i) {                                                                   \
+            __dc4c_btree_free_##name(inner->children[i], height - 1);                                                  \
+        }                                                                                                              \
+    }                                                                                                                  \
+    free(node);                                                                                                        \
+}                                                                                                                      \
+                                                                                                                       \
+static inline void __dc4c_btree_inner_insert_##name(struct btree_inner_##name* inner, size_t slot,                     \
+                                                    keyType separator, void* child) {                                  \
+    memmove(&inner->keys[slot + 1], &inner->keys[slot], (inner->count - slot) * sizeof(keyType));                      \
+    memmove(&inner->children[slot + 2], &inner->children[slot + 1], (inner->count - slot) * sizeof(void*));            \
+    inner->keys[slot]         = separator;                                                                             \
+    inner->children[slot + 1] = child;                                                                                 \
+    ++inner->count;                                                                                                    \
+}                                                                                                                      \
+                                                                                                                       \
+static inline void btree_destroy_##name(struct btree_##name* self) {                                                   \
+    if (self->root != NULL) {                                                                                          \
+        __dc4c_btree_free_##name(self->root, self->height);                                                            \
+    }                                                                                                                  \
+    self->count  = 0;                                                                                                  \
+    self->height = 0;                                                                                                  \
+    self->root   = NULL;                                                                                               \
+    self->first  = NULL;                                                                                               \
+}                                                                                                                      \
+                                                                                                                       \
+static inline bool btree_insert_##name(struct btree_##name* self, keyType key, valueType value) {                      \
+    if (self->root == NULL) {                                                                                          \
+        struct btree_leaf_##name* leaf = (struct btree_leaf_##name*) malloc(sizeof(struct btree_leaf_##name));         \
+        if (leaf == NULL) {                                                                                            \
+            return false;                                                                                              \
+        }                                                                                                              \
+        leaf->count  = 0;                                                                                              \
+        leaf->next   = NULL;                                                                                           \
+        self->root   = leaf;                                                                                           \
+        self->first  = leaf;                                                                                           \
+        self->height = 1;                                                                                              \
+    }                                                                                                                  \
+    struct btree_inner_##name* path[__DC4C_BTREE_MAX_HEIGHT];                                                          \
+    size_t                     slots[__DC4C_BTREE_MAX_HEIGHT];                                                         \
+    void* node = self->root;                                                                                           \
+    for (size_t level = self->height; level > 1; --level) {                                                            \
+        struct btree_inner_##name* inner = (struct btree_inner_##name*) node;                                          \
+        path[level]  = inner;                                                                                          \
+        slots[level] = __dc4c_btree_upper_bound_##name(inner->keys, inner->count, &key);                               \
+        node = inner->children[slots[level]];                                                                          \
+    }                                                                                                                  \
+    struct btree_leaf_##name* leaf = (struct btree_leaf_##name*) node;                                                 \
+    size_t position = __dc4c_btree_lower_bound_##name(leaf->keys, leaf->count, &key);                                  \
+    if (position < leaf->count && comp(&leaf->keys[position], &key) == 0) {                                            \
+        leaf->values[position] = value;                                                                                \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    struct btree_leaf_##name*  right = NULL;                                                                           \
+    struct btree_inner_##name* inners[__DC4C_BTREE_MAX_HEIGHT];                                                        \
+    size_t splits = 0;                                                                                                 \
+    if (leaf->count == DC4C_BTREE_ORDER) {                                                                             \
+        while (splits + 2 <= self->height && path[splits + 2]->count == DC4C_BTREE_ORDER) {                            \
+            ++splits;                                                                                                  \
+        }                                                                                                              \
+        const size_t needed = splits + (splits + 1 == self->height);                                                   \
+        right = (struct btree_leaf_##name*) malloc(sizeof(struct btree_leaf_##name));                                  \
+        for (size_t i = 0; i < needed; ++i) {                                                                          \
+            inners[i] = right == NULL ? NULL : (struct btree_inner_##name*) malloc(sizeof(struct btree_inner_##name)); \
+            if (inners[i] == NULL) {                                                                                   \
+                for (size_t j = 0; j < i; ++j) {                                                                       \
+                    free(inners[j]);                                                                                   \
+                }                                                                                                      \
+                free(right);                                                                                           \
+                return false;                                                                                          \
+            }                                                                                                          \
+        }                                                                                                              \
+        if (right == NULL) {                                                                                           \
+            return false;                                                                                              \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    if (right != NULL) {                                                                                               \
+        const size_t half = DC4C_BTREE_ORDER / 2;                                                                      \
+        right->count = DC4C_BTREE_ORDER - half;                                                                        \
+        right->next  = leaf->next;                                                                                     \
+        memcpy(right->keys, &leaf->keys[half], right->count * sizeof(keyType));                                        \
+        memcpy(right->values, &leaf->values[half], right->count * sizeof(valueType));                                  \
+        leaf->count = half;                                                                                            \
+        leaf->next  = right;                                                                                           \
+        if (position > half) {                                                                                         \
+            leaf      = right;                                                                                         \
+            position -= half;                                                                                          \
+        }                                                                                                              \
+    }                                                                                                                  \
+    memmove(&leaf->keys[position + 1], &leaf->keys[position], (leaf->count - position) * sizeof(keyType));             \
+    memmove(&leaf->values[position + 1], &leaf->values[position], (leaf->count - position) * sizeof(valueType));       \
+    leaf->keys[position]   = key;                                                                                      \
+    leaf->values[position] = value;                                                                                    \
+    ++leaf->count;                                                                                                     \
+    ++self->count;                                                                                                     \
+    if (right == NULL) {                                                                                               \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    keyType separator = right->keys[0];                                                                                \
+    void*   sibling   = right;                                                                                         \
+    for (size_t level = 2, i = 0; level <= self->height; ++level) {                                                    \
+        struct btree_inner_##name* inner = path[level];                                                                \
+        size_t slot = slots[level];                                                                                    \
+        if (inner->count == DC4C_BTREE_ORDER) {                                                                        \
+            const size_t half = DC4C_BTREE_ORDER / 2;                                                                  \
+            struct btree_inner_##name* split = inners[i++];                                                            \
+            split->count = DC4C_BTREE_ORDER - half - 1;                                                                \
+            memcpy(split->keys, &inner->keys[half + 1], split->count * sizeof(keyType));                               \
+            memcpy(split->children, &inner->children[half + 1], (split->count + 1) * sizeof(void*));                   \
+            inner->count = half;                                                                                       \
+            const keyType promoted = inner->keys[half];                                                                \
+            if (slot > half) {                                                                                         \
+                __dc4c_btree_inner_insert_##name(split, slot - half - 1, separator, sibling);                          \
+            } else {                                                                                                   \
+                __dc4c_btree_inner_insert_##name(inner, slot, separator, sibling);                                     \
+            }                                                                                                          \
+            separator = promoted;                                                                                      \
+            sibling   = split;                                                                                         \
+        } else {                                                                                                       \
+            __dc4c_btree_inner_insert_##name(inner, slot, separator, sibling);                                         \
+            return true;                                                                                               \
+        }                                                                                                              \
+    }                                                                                                                  \
+    struct btree_inner_##name* root = inners[splits];                                                                  \
+    root->count       = 1;                                                                                             \
+    root->keys[0]     = separator;                                                                                     \
+    root->children[0] = self->root;                                                                                    \
+    root->children[1] = sibling;                                                                                       \
+    self->root        = root;                                                                                          \
+    ++self->height;                                                                                                    \
+    return true;                                                                                                       \
+}                                                                                                                      \
+                                                                                                                       \
+static inline valueType* btree_find_##name(const struct btree_##name* self, keyType key) {                             \
+    if (self->root == NULL) {                                                                                          \
+        return NULL;                                                                                                   \
+    }                                                                                                                  \
+    struct btree_leaf_##name* leaf = __dc4c_btree_leaf_of_##name(self, &key);                                          \
+    const size_t position = __dc4c_btree_lower_bound_##name(leaf->keys, leaf->count, &key);                            \
+    if (position < leaf->count && comp(&leaf->keys[position], &key) == 0) {                                            \
+        return &leaf->values[position];                                                                                \
+    }                                                                                                                  \
+    return NULL;                                                                                                       \
+}                                                                                                                      \
+                                                                                                                       \
+static inline bool btree_erase_##name(struct btree_##name* self, keyType key) {                                        \
+    if (self->root == NULL) {                                                                                          \
+        return false;                                                                                                  \
+    }                                                                                                                  \
+    struct btree_leaf_##name* leaf = __dc4c_btree_leaf_of_##name(self, &key);                                          \
+    const size_t position = __dc4c_btree_lower_bound_##name(leaf->keys, leaf->count, &key);                            \
+    if (position == leaf->count || comp(&leaf->keys[position], &key) != 0) {                                           \
+        return false;                                                                                                  \
+    }                                                                                                                  \
+    --leaf->count;                                                                                                     \
+    memmove(&leaf->keys[position], &leaf->keys[position + 1], (leaf->count - position) * sizeof(keyType));             \
+    memmove(&leaf->values[position], &leaf->values[position + 1], (leaf->count - position) * sizeof(valueType));       \
+    --self->count;                                                                                                     \
+    return true;                                                                                                       \
+}                                                                                                                      \
+                                                                                                                       \
+static inline struct btree_iterator_##name btree_lower_bound_##name(const struct btree_##name* self, keyType key) {    \
+    struct btree_iterator_##name toReturn = { NULL, 0 };                                                               \
+    if (self->root != NULL) {                                                                                          \
+        toReturn.leaf     = __dc4c_btree_leaf_of_##name(self, &key);                                                   \
+        toReturn.position = __dc4c_btree_lower_bound_##name(toReturn.leaf->keys, toReturn.leaf->count, &key);          \
+    }                                                                                                                  \
+    return toReturn;                                                                                                   \
+}                                                                                                                      \
+                                                                                                                       \
+static inline struct btree_iterator_##name btree_upper_bound_##name(const struct btree_##name* self, keyType key) {    \
+    struct btree_iterator_##name toReturn = { NULL, 0 };                                                               \
+    if (self->root != NULL) {                                                                                          \
+        toReturn.leaf     = __dc4c_btree_leaf_of_##name(self, &key);                                                   \
+        toReturn.position = __dc4c_btree_upper_bound_##name(toReturn.leaf->keys, toReturn.leaf->count, &key);          \
+    }                                                                                                                  \
+    return toReturn;                                                                                                   \
+}                                                                                                                      \
+                                                                                                                       \
+static inline bool btree_bulk_load_##name(struct btree_##name* self, const struct vector_##name* vector) {             \
+    if (vector->count == 0) {                                                                                          \
+        btree_destroy_##name(self);                                                                                    \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+    size_t count = (vector->count + DC4C_BTREE_ORDER - 1) / DC4C_BTREE_ORDER;                                          \
+    void**   nodes = (void**) malloc(count * sizeof(void*));                                                           \
+    keyType* mins  = (keyType*) malloc(count * sizeof(keyType));                                                       \
+    if (nodes == NULL || mins == NULL) {                                                                               \
+        free(nodes);                                                                                                   \
+        free(mins);                                                                                                    \
+        return false;                                                                                                  \
+    }                                                                                                                  \
+    struct btree_leaf_##name* first    = NULL;                                                                         \
+    struct btree_leaf_##name* previous = NULL;                                                                         \
+    for (size_t i = 0, offset = 0; i < count; ++i) {                                                                   \
+        struct btree_leaf_##name* leaf = (struct btree_leaf_##name*) malloc(sizeof(struct btree_leaf_##name));         \
+        if (leaf == NULL) {                                                                                            \
+            for (size_t j = 0; j < i; ++j) {                                                                           \
+                free(nodes[j]);                                                                                        \
+            }                                                                                                          \
+            free(nodes);                                                                                               \
+            free(mins);                                                                                                \
+            return false;                                                                                              \
+        }                                                                                                              \
+        leaf->count = vector->count / count + (i < vector->count % count);                                             \
+        leaf->next  = NULL;                                                                                            \
+        for (size_t j = 0; j < leaf->count; ++j) {                                                                     \
+            leaf->keys[j]   = vector->content[offset + j].first;                                                       \
+            leaf->values[j] = vector->content[offset + j].second;                                                      \
+        }                                                                                                              \
+        if (previous != NULL) {                                                                                        \
+            previous->next = leaf;                                                                                     \
+        } else {                                                                                                       \
+            first = leaf;                                                                                              \
+        }                                                                                                              \
+        previous = leaf;                                                                                               \
+        nodes[i] = leaf;                                                                                               \
+        mins[i]  = leaf->keys[0];                                                                                      \
+        offset  += leaf->count;                                                                                        \
+    }                                                                                                                  \
+    size_t height = 1;                                                                                                 \
+    while (count > 1) {                                                                                                \
+        const size_t parents = (count + DC4C_BTREE_ORDER) / (DC4C_BTREE_ORDER + 1);                                    \
+        for (size_t i = 0, offset = 0; i < parents; ++i) {                                                             \
+            struct btree_inner_##name* inner = (struct btree_inner_##name*)                                            \
+                malloc(sizeof(struct btree_inner_##name));                                                             \
+            if (inner == NULL) {                                                                                       \
+                for (size_t j = 0; j < i; ++j) {                                                                       \
+                    __dc4c_btree_free_##name(nodes[j], height + 1);                                                    \
+                }                                                                                                      \
+                for (size_t j = offset; j < count; ++j) {                                                              \
+                    __dc4c_btree_free_##name(nodes[j], height);                                                        \
+                }                                                                                                      \
+                free(nodes);                                                                                           \
+                free(mins);                                                                                            \
+                return false;                                                                                          \
+            }                                                                                                          \
+            const size_t children = count / parents + (i < count % parents);                                           \
+            inner->count = children - 1;                                                                               \
+            for (size_t j = 0; j < children; ++j) {                                                                    \
+                inner->children[j] = nodes[offset + j];                                                                \
+                if (j > 0) {                                                                                           \
+                    inner->keys[j - 1] = mins[offset + j];                                                             \
+                }                                                                                                      \
+            }                                                                                                          \
+            const keyType min = mins[offset];                                                                          \
+            nodes[i] = inner;                                                                                          \
+            mins[i]  = min;                                                                                            \
+            offset  += children;                                                                                       \
+        }                                                                                                              \
+        count = parents;                                                                                               \
+        ++height;                                                                                                      \
+    }                                                                                                                  \
+    btree_destroy_##name(self);                                                                                        \
+    self->root   = nodes[0];                                                                                           \
+    self->height = height;                                                                                             \
+    self->first  = first;                                                                                              \
+    self->count  = vector->count;                                                                                      \
+    free(nodes);                                                                                                       \
+    free(mins);                                                                                                        \
+    return true;                                                                                                       \
+}
+
+/**
+ * @brief Defines a B+tree of the given name mapping the given key type to the given value type.
+ *
+ * The nodes hold up to @c DC4C_BTREE_ORDER keys. All pairs are stored in the
+ * leaves, which are linked for the iteration in ascending order of the keys.
+ * Erasing is lazy: nodes are never merged, emptied leaves stay in place until
+ * the B+tree is destroyed or bulk loaded.<br>
+ * Bulk loading takes a DC4C vector of the pair of the same name, both need to
+ * be defined before.<br>
+ * The following functions are defined:
+ * - @c btree_insert_NAME(btree, key, value) inserts or replaces a value, returns whether it succeeded
+ * - @c btree_find_NAME(btree, key) returns a pointer to the value of the key or @c NULL
+ * - @c btree_erase_NAME(btree, key) removes the key, returns whether it was found
+ * - @c btree_lower_bound_NAME(btree, key) returns an iterator to the first key not less than the given one
+ * - @c btree_upper_bound_NAME(btree, key) returns an iterator to the first key greater than the given one
+ * - @c btree_bulk_load_NAME(btree, vector) replaces the content by the pairs of the vector sorted by unique keys
+ * - @c btree_destroy_NAME(btree) destroys the B+tree
+ *
+ * @param name the name of the B+tree, of its pair and of the vector of pairs
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ * @param comp the comparison function, called with two pointers to the key type
+ */
+#define typedef_btree_named(name, keyType, valueType, comp) \
+__dc4c_btree_named(name, keyType, valueType);               \
+__dc4c_btree_methods(name, keyType, valueType, comp)        \
+__dc4c_btree_cxx_wrapper(name, keyType, valueType)          \
+typedef struct btree_##name btree_##name##_t
+
+/** The initial values for a B+tree. */
+#define btree_initializer { 0, 0, NULL, NULL }
+
+/**
+ * Initializes the given B+tree.
+ *
+ * @param btreePtr the pointer to the B+tree
+ */
+#define btree_init(btreePtr)                          \
+do {                                                  \
+    __DC4C_TYPEOF((btreePtr)) __b_bti = (btreePtr);   \
+                                                      \
+    __b_bti->count  = 0;                              \
+    __b_bti->height = 0;                              \
+    __b_bti->root   = NULL;                           \
+    __b_bti->first  = NULL;                           \
+} while (0)
+
+/**
+ * Returns the amount of pairs stored in the given B+tree.
+ *
+ * @param btreePtr the pointer to the B+tree
+ * @return the amount of pairs
+ */
+#define btree_size(btreePtr) ({ (btreePtr)->count; })
+
+/**
+ * @brief Moves the given iterator forward to the next stored pair unless it
+ * already points to one.
+ *
+ * Iterators may point behind the last pair of a leaf, for example after
+ * erasing. They are settled by the iteration macros.
+ *
+ * @param iteratorPtr the pointer to the iterator
+ * @return whether the iterator points to a stored pair
+ */
+#define btree_iterator_valid(iteratorPtr) ({                                        \
+    __DC4C_TYPEOF((iteratorPtr)) __i_btiv = (iteratorPtr);                          \
+                                                                                    \
+    while (__i_btiv->leaf != NULL && __i_btiv->position >= __i_btiv->leaf->count) { \
+        __i_btiv->leaf     = __i_btiv->leaf->next;                                  \
+        __i_btiv->position = 0;                                                     \
+    }                                                                               \
+    __i_btiv->leaf != NULL;                                                         \
+})
+
+/**
+ * @brief Returns a pointer to the key the given iterator points to.
+ *
+ * The iterator needs to be valid.
+ *
+ * @param iteratorPtr the pointer to the iterator
+ * @return the pointer to the key
+ */
+#define btree_iterator_key(iteratorPtr) ({                                                         \
+    __DC4C_TYPEOF((iteratorPtr)) __i_btik = (iteratorPtr);                                         \
+    (const __DC4C_VALUE_TYPEOF(*__i_btik->leaf->keys)*) &__i_btik->leaf->keys[__i_btik->position]; \
+})
+
+/**
+ * @brief Returns a pointer to the value the given iterator points to.
+ *
+ * The iterator needs to be valid.
+ *
+ * @param iteratorPtr the pointer to the iterator
+ * @return the pointer to the value
+ */
+#define btree_iterator_value(iteratorPtr) ({                 \
+    __DC4C_TYPEOF((iteratorPtr)) __i_btival = (iteratorPtr); \
+    &__i_btival->leaf->values[__i_btival->position];         \
+})
+
+/**
+ * @brief Advances the given iterator to the next pair.
+ *
+ * The iterator needs to be valid.
+ *
+ * @param iteratorPtr the pointer to the iterator
+ * @return whether the iterator points to a stored pair
+ */
+#define btree_iterator_next(iteratorPtr) ({                \
+    __DC4C_TYPEOF((iteratorPtr)) __i_btin = (iteratorPtr); \
+    ++__i_btin->position;                                  \
+    btree_iterator_valid(__i_btin);                        \
+})
+
+/**
+ * @brief Iterates over the pairs of a B+tree from the given position up to the given end position.
+ *
+ * The block may leave the iteration using @c break .
+ *
+ * @param leafBegin the leaf to start in
+ * @param positionBegin the position inside of the starting leaf
+ * @param leafEnd the leaf to end in, @c NULL to iterate to the end
+ * @param positionEnd the position inside of the ending leaf
+ * @param keyName the name of the variable holding a pointer to the current key
+ * @param valueName the name of the variable holding a pointer to the current value
+ * @param block the block to be executed
+ */
+#define __dc4c_btree_forEach(leafBegin, positionBegin, leafEnd, positionEnd, keyName, valueName, block) \
+do {                                                                                                    \
+    __DC4C_VALUE_TYPEOF((leafBegin)) __l_btfe  = (leafBegin);                                           \
+    __DC4C_VALUE_TYPEOF((leafBegin)) __le_btfe = (leafEnd);                                             \
+    size_t                           __pe_btfe = (positionEnd);                                         \
+                                                                                                        \
+    while (__le_btfe != NULL && __pe_btfe >= __le_btfe->count) {                                        \
+        __le_btfe = __le_btfe->next;                                                                    \
+        __pe_btfe = 0;                                                                                  \
+    }                                                                                                   \
+    for (size_t __p_btfe = (positionBegin); ({                                                          \
+            while (__l_btfe != NULL && __p_btfe >= __l_btfe->count) {                                   \
+                __l_btfe = __l_btfe->next;                                                              \
+                __p_btfe = 0;                                                                           \
+            }                                                                                           \
+            __l_btfe != NULL && (__l_btfe != __le_btfe || __p_btfe != __pe_btfe);                       \
+         }); ++__p_btfe) {                                                                              \
+        const __DC4C_VALUE_TYPEOF(*__l_btfe->keys)* keyName   = &__l_btfe->keys[__p_btfe];              \
+        __DC4C_VALUE_TYPEOF(*__l_btfe->values)*     valueName = &__l_btfe->values[__p_btfe];            \
+        (void) keyName;                                                                                 \
+        (void) valueName;                                                                               \
+        { block }                                                                                       \
+    }                                                                                                   \
+} while (0)
+
+/**
+ * @brief Iterates over the pairs of the given B+tree in ascending order of their keys.
+ *
+ * The block may leave the iteration using @c break . The B+tree must not be
+ * modified during the iteration, except for the values.
+ *
+ * @param btreePtr the pointer to the B+tree
+ * @param keyName the name of the variable holding a pointer to the current key
+ * @param valueName the name of the variable holding a pointer to the current value
+ * @param block the block to be executed
+ */
+#define btree_forEach(btreePtr, keyName, valueName, block) \
+    __dc4c_btree_forEach((btreePtr)->first, 0, NULL, 0, keyName, valueName, block)
+
+/**
+ * @brief Iterates over the pairs between the two given iterators.
+ *
+ * The pair the end iterator points to is not included. Together with
+ * @c btree_lower_bound_NAME this allows to iterate over a range of keys. The
+ * block may leave the iteration using @c break .
+ *
+ * @param begin the iterator to the first pair
+ * @param end the iterator behind the last pair
+ * @param keyName the name of the variable holding a pointer to the current key
+ * @param valueName the name of the variable holding a pointer to the current value
+ * @param block the block to be executed
+ */
+#define btree_forEachBetween(begin, end, keyName, valueName, block)                          \
+do {                                                                                         \
+    __DC4C_VALUE_TYPEOF((begin)) __b_btfb = (begin);                                         \
+    __DC4C_VALUE_TYPEOF((begin)) __e_btfb = (end);                                           \
+                                                                                             \
+    __dc4c_btree_forEach(__b_btfb.leaf, __b_btfb.position, __e_btfb.leaf, __e_btfb.position, \
+                         keyName, valueName, block);                                         \
+} while (0)
+
+#ifdef __cplusplus
+# include "btree.hpp"
+#endif
+
+#ifndef __dc4c_btree_cxx_wrapper
+# define __dc4c_btree_cxx_wrapper(name, keyType, valueType)
+#endif
+
+#endif /* __DC4C_btree_h */
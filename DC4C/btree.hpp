@@ -0,0 +1,324 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_btree_h
+# warning Wrong inclusion of "btree.hpp" redirected to #include "btree.h"!
+# include "btree.h"
+#else
+# ifndef __DC4C_btree_hpp
+# define __DC4C_btree_hpp
+
+# include <iterator>
+# include <new>
+# include <utility>
+
+namespace dc4c {
+/**
+ * The functions of a C B+tree, specialized by @c typedef_btree_named .
+ *
+ * @tparam T the C DC4C B+tree type
+ */
+template<typename T>
+struct btree_traits;
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for the C B+tree of DC4C.
+ *
+ * It offers a subset of the interface of the @c std::map . The iterators are
+ * invalidated by insertions and erasures.
+ *
+ * @tparam T the C DC4C B+tree type to be managed by this wrapper class
+ */
+template<typename T>
+class btree {
+    /** The functions of the C B+tree. */
+    using traits = btree_traits<T>;
+
+    /** The underlying C B+tree. */
+    T underlying;
+
+public:
+    /** The type used for the size of the B+tree. */
+    using size_type = std::size_t;
+    /** The type of the keys.                      */
+    using key_type = typename traits::key_type;
+    /** The type of the values.                    */
+    using mapped_type = typename traits::mapped_type;
+
+    /**
+     * This class iterates over the pairs of a B+tree in ascending order of their keys.
+     */
+    class iterator {
+        /** The underlying C iterator. */
+        typename traits::iterator_type underlying;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<const key_type&, mapped_type&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+        /**
+         * Constructs an iterator from the given C iterator.
+         *
+         * @param underlying the C iterator
+         */
+        inline iterator(typename traits::iterator_type underlying) noexcept: underlying(underlying) {
+            btree_iterator_valid(&this->underlying);
+        }
+
+        inline auto operator*() const noexcept -> reference {
+            return reference(*btree_iterator_key(&underlying), *btree_iterator_value(&underlying));
+        }
+
+        inline auto operator++() noexcept -> iterator& {
+            btree_iterator_next(&underlying);
+            return *this;
+        }
+
+        inline auto operator++(int) noexcept -> iterator {
+            auto toReturn = *this;
+            ++*this;
+            return toReturn;
+        }
+
+        inline auto operator==(const iterator& other) const noexcept -> bool {
+            return underlying.leaf == other.underlying.leaf && underlying.position == other.underlying.position;
+        }
+
+        inline auto operator!=(const iterator& other) const noexcept -> bool {
+            return !(*this == other);
+        }
+
+        /**
+         * Returns the key the iterator points to.
+         *
+         * @return the current key
+         */
+        inline auto key() const noexcept -> const key_type& {
+            return *btree_iterator_key(&underlying);
+        }
+
+        /**
+         * Returns the value the iterator points to.
+         *
+         * @return the current value
+         */
+        inline auto value() const noexcept -> mapped_type& {
+            return *btree_iterator_value(&underlying);
+        }
+    };
+
+    inline btree(): underlying(btree_initializer) {}
+
+    btree(const btree&) = delete;
+
+    inline btree(btree&& other) noexcept: underlying(other.underlying) {
+        btree_init(&other.underlying);
+    }
+
+    inline ~btree() {
+        traits::destroy(&underlying);
+    }
+
+    auto operator=(const btree&) -> btree& = delete;
+
+    inline auto operator=(btree&& other) noexcept -> btree& {
+        traits::destroy(&underlying);
+        underlying = other.underlying;
+        btree_init(&other.underlying);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the underlying C B+tree.
+     *
+     * @return the underlying C B+tree
+     */
+    __DC4C_CONSTEXPR_SINCE_CXX14 inline auto data() noexcept -> T& {
+        return underlying;
+    }
+
+    /**
+     * Inserts the given pair or replaces the value of the given key.
+     *
+     * @param key the key
+     * @param value the value
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void insert(const key_type& key, const mapped_type& value) {
+        if (!traits::insert(&underlying, key, value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Returns the value of the given key.
+     *
+     * @param key the key
+     * @return a pointer to the value or @c nullptr if the key is not stored
+     */
+    inline auto find(const key_type& key) const noexcept -> mapped_type* {
+        return traits::find(&underlying, key);
+    }
+
+    /**
+     * Returns whether the given key is stored.
+     *
+     * @param key the key
+     * @return whether the key is stored
+     */
+    inline auto contains(const key_type& key) const noexcept -> bool {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * Removes the given key.
+     *
+     * @param key the key
+     * @return the amount of removed pairs
+     */
+    inline auto erase(const key_type& key) noexcept -> size_type {
+        return traits::erase(&underlying, key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Replaces the content by the pairs of the given vector.
+     *
+     * The pairs need to be sorted by their keys, which need to be unique.
+     *
+     * @param pairs the vector of the pairs
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void bulk_load(const vector<typename traits::vector_type>& pairs) {
+        if (!traits::bulk_load(&underlying, &pairs.data())) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Returns an iterator to the first pair whose key is not less than the given one.
+     *
+     * @param key the key
+     * @return the iterator
+     */
+    inline auto lower_bound(const key_type& key) const noexcept -> iterator {
+        return iterator(traits::lower_bound(&underlying, key));
+    }
+
+    /**
+     * Returns an iterator to the first pair whose key is greater than the given one.
+     *
+     * @param key the key
+     * @return the iterator
+     */
+    inline auto upper_bound(const key_type& key) const noexcept -> iterator {
+        return iterator(traits::upper_bound(&underlying, key));
+    }
+
+    /**
+     * Returns an iterator to the pair with the smallest key.
+     *
+     * @return the iterator
+     */
+    inline auto begin() const noexcept -> iterator {
+        return iterator({ underlying.first, 0 });
+    }
+
+    /**
+     * Returns a past the end iterator.
+     *
+     * @return the iterator
+     */
+    inline auto end() const noexcept -> iterator {
+        return iterator({ nullptr, 0 });
+    }
+
+    /**
+     * Returns the amount of pairs stored in this B+tree.
+     *
+     * @return the amount of pairs
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.count;
+    }
+
+    /**
+     * Returns whether this B+tree is empty.
+     *
+     * @return whether no pairs are stored
+     */
+    constexpr inline auto empty() const noexcept -> bool {
+        return underlying.count == 0;
+    }
+};
+}
+
+/**
+ * Defines the C++ wrapper of the B+tree of the given name.
+ *
+ * @param name the name of the C B+tree
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ */
+# define __dc4c_btree_cxx_wrapper(name, keyType, valueType)                                               \
+namespace dc4c {                                                                                          \
+template<>                                                                                                \
+struct btree_traits<::btree_##name> {                                                                     \
+    using key_type      = keyType;                                                                        \
+    using mapped_type   = valueType;                                                                      \
+    using iterator_type = ::btree_iterator_##name;                                                        \
+    using vector_type   = ::vector_##name;                                                                \
+                                                                                                          \
+    static inline void destroy(::btree_##name* self) {                                                    \
+        btree_destroy_##name(self);                                                                       \
+    }                                                                                                     \
+                                                                                                          \
+    static inline auto insert(::btree_##name* self, const keyType& key, const valueType& value) -> bool { \
+        return btree_insert_##name(self, key, value);                                                     \
+    }                                                                                                     \
+                                                                                                          \
+    static inline auto find(const ::btree_##name* self, const keyType& key) -> valueType* {               \
+        return btree_find_##name(self, key);                                                              \
+    }                                                                                                     \
+                                                                                                          \
+    static inline auto erase(::btree_##name* self, const keyType& key) -> bool {                          \
+        return btree_erase_##name(self, key);                                                             \
+    }                                                                                                     \
+                                                                                                          \
+    static inline auto bulk_load(::btree_##name* self, const vector_type* vector) -> bool {               \
+        return btree_bulk_load_##name(self, vector);                                                      \
+    }                                                                                                     \
+                                                                                                          \
+    static inline auto lower_bound(const ::btree_##name* self, const keyType& key) -> iterator_type {     \
+        return btree_lower_bound_##name(self, key);                                                       \
+    }                                                                                                     \
+                                                                                                          \
+    static inline auto upper_bound(const ::btree_##name* self, const keyType& key) -> iterator_type {     \
+        return btree_upper_bound_##name(self, key);                                                       \
+    }                                                                                                     \
+};                                                                                                        \
+}                                                                                                         \
+namespace dc4c {                                                                                          \
+using btree_##name = btree<::btree_##name>;                                                               \
+}
+
+# endif /* __DC4C_btree_hpp */
+#endif /* !__DC4C_btree_h */
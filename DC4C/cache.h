@@ -0,0 +1,465 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_cache_h
+#define __DC4C_cache_h
+
+#if __STDC_VERSION__ < 202311L
+# include <stdbool.h>
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "optional.h"
+#include "vector.h"
+
+/** The marker of a missing slot. */
+#define __DC4C_CACHE_NONE SIZE_MAX
+
+/**
+ * The eviction policies available for caches.
+ */
+enum cache_policy {
+    /** Evicts the least recently used pair.                                                    */
+    CACHE_LRU,
+    /** Evicts the next pair not used since the clock hand passed it, resisting one-time scans. */
+    CACHE_CLOCK
+};
+
+/**
+ * @brief Defines the structures of the cache.
+ *
+ * The slots and the hash index are allocated in one block. The slots are
+ * linked in the order of their usage for the LRU policy, the free slots are
+ * linked using the same links.
+ *
+ * @param name the name of the cache
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ */
+#define __dc4c_cache_named(name, keyType, valueType) \
+struct cache_slot_##name {                           \
+    keyType   key;                                   \
+    valueType value;                                 \
+    size_t    hash;                                  \
+    size_t    previous;                              \
+    size_t    next;                                  \
+    bool      used;                                  \
+    bool      referenced;                            \
+};                                                   \
+                                                     \
+struct cache_##name {                                \
+    size_t                    count;                 \
+    size_t                    capacity;              \
+    enum cache_policy         policy;                \
+    size_t                    fresh;                 \
+    size_t                    freeList;              \
+    size_t                    head;                  \
+    size_t                    tail;                  \
+    size_t                    hand;                  \
+    size_t                    mask;                  \
+    size_t                    hits;                  \
+    size_t                    misses;                \
+    size_t                    evictions;             \
+    struct cache_slot_##name* slots;                 \
+    size_t*                   index;                 \
+}
+
+/**
+ * @brief Defines the functions of the cache.
+ *
+ * The given hash function is called with a pointer to a key and returns its
+ * hash value. The given comparison function is called with two pointers to
+ * keys and returns zero if they are equal. Both are called directly, allowing
+ * the compiler to inline them.<br>
+ * The hash index uses linear probing and is at most half full. Removed
+ * entries are shifted back instead of being marked, so no tombstones
+ * accumulate.
+ *
+ * @param name the name of the cache
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ * @param hashFunction the hash function
+ * @param comp the comparison function
+ */
+#define __dc4c_cache_methods(name, keyType, valueType, hashFunction, comp)                                           \
+static inline size_t __dc4c_cache_find_##name(const struct cache_##name* self, const keyType* key, size_t keyHash) { \
+    for (size_t position = keyHash & self->mask;; position = (position + 1) & self->mask) {                          \
+        const size_t slot = self->index[position];                                                                   \
+        if (slot == 0) {                                                                                             \
+            return position;                                                                                         \
+        }                                                                                                            \
+        if (self->slots[slot - 1].hash == keyHash && comp(&self->slots[slot - 1].key, key) == 0) {                   \
+            return position;                                                                                         \
+        }                                                                                                            \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void __dc4c_cache_unindex_##name(struct cache_##name* self, size_t slot) {                             \
+    size_t position = self->slots[slot].hash & self->mask;                                                           \
+    while (self->index[position] != slot + 1) {                                                                      \
+        position = (position + 1) & self->mask;                                                                      \
+    }                                                                                                                \
+    for (size_t next = (position + 1) & self->mask; self->index[next] != 0; next = (next + 1) & self->mask) {        \
+        const size_t home = self->slots[self->index[next] - 1].hash & self->mask;                                    \
+        if (((next - home) & self->mask) >= ((next - position) & self->mask)) {                                      \
+            self->index[position] = self->index[next];                                                               \
+            position = next;                                                                                         \
+        }                                                                                                            \
+    }                                                                                                                \
+    self->index[position] = 0;                                                                                       \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void __dc4c_cache_unlink_##name(struct cache_##name* self, size_t slot) {                              \
+    struct cache_slot_##name* entry = &self->slots[slot];                                                            \
+    if (entry->previous == __DC4C_CACHE_NONE) {                                                                      \
+        self->head = entry->next;                                                                                    \
+    } else {                                                                                                         \
+        self->slots[entry->previous].next = entry->next;                                                             \
+    }                                                                                                                \
+    if (entry->next == __DC4C_CACHE_NONE) {                                                                          \
+        self->tail = entry->previous;                                                                                \
+    } else {                                                                                                         \
+        self->slots[entry->next].previous = entry->previous;                                                         \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void __dc4c_cache_link_##name(struct cache_##name* self, size_t slot) {                                \
+    struct cache_slot_##name* entry = &self->slots[slot];                                                            \
+    entry->previous = __DC4C_CACHE_NONE;                                                                             \
+    entry->next     = self->head;                                                                                    \
+    if (self->head == __DC4C_CACHE_NONE) {                                                                           \
+        self->tail = slot;                                                                                           \
+    } else {                                                                                                         \
+        self->slots[self->head].previous = slot;                                                                     \
+    }                                                                                                                \
+    self->head = slot;                                                                                               \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void __dc4c_cache_touch_##name(struct cache_##name* self, size_t slot) {                               \
+    if (self->policy == CACHE_CLOCK) {                                                                               \
+        self->slots[slot].referenced = true;                                                                         \
+    } else if (self->head != slot) {                                                                                 \
+        __dc4c_cache_unlink_##name(self, slot);                                                                      \
+        __dc4c_cache_link_##name(self, slot);                                                                        \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline size_t __dc4c_cache_evict_##name(struct cache_##name* self) {                                          \
+    size_t toReturn;                                                                                                 \
+    if (self->policy == CACHE_CLOCK) {                                                                               \
+        for (;; self->hand = self->hand + 1 == self->capacity ? 0 : self->hand + 1) {                                \
+            struct cache_slot_##name* entry = &self->slots[self->hand];                                              \
+            if (!entry->used) {                                                                                      \
+                continue;                                                                                            \
+            }                                                                                                        \
+            if (!entry->referenced) {                                                                                \
+                break;                                                                                               \
+            }                                                                                                        \
+            entry->referenced = false;                                                                               \
+        }                                                                                                            \
+        toReturn   = self->hand;                                                                                     \
+        self->hand = self->hand + 1 == self->capacity ? 0 : self->hand + 1;                                          \
+    } else {                                                                                                         \
+        toReturn = self->tail;                                                                                       \
+        __dc4c_cache_unlink_##name(self, toReturn);                                                                  \
+    }                                                                                                                \
+    __dc4c_cache_unindex_##name(self, toReturn);                                                                     \
+    --self->count;                                                                                                   \
+    ++self->evictions;                                                                                               \
+    return toReturn;                                                                                                 \
+}                                                                                                                    \
+                                                                                                                     \
+static inline bool cache_init_##name(struct cache_##name* self, size_t capacity, enum cache_policy policy) {         \
+    if (capacity == 0 || capacity > SIZE_MAX / 4 / sizeof(struct cache_slot_##name)) {                               \
+        return false;                                                                                                \
+    }                                                                                                                \
+    size_t indexCap = 16;                                                                                            \
+    while (indexCap < 2 * capacity) {                                                                                \
+        indexCap *= 2;                                                                                               \
+    }                                                                                                                \
+    void* block = malloc(capacity * sizeof(struct cache_slot_##name) + indexCap * sizeof(size_t));                   \
+    if (block == NULL) {                                                                                             \
+        return false;                                                                                                \
+    }                                                                                                                \
+    self->count     = 0;                                                                                             \
+    self->capacity  = capacity;                                                                                      \
+    self->policy    = policy;                                                                                        \
+    self->fresh     = 0;                                                                                             \
+    self->freeList  = __DC4C_CACHE_NONE;                                                                             \
+    self->head      = __DC4C_CACHE_NONE;                                                                             \
+    self->tail      = __DC4C_CACHE_NONE;                                                                             \
+    self->hand      = 0;                                                                                             \
+    self->mask      = indexCap - 1;                                                                                  \
+    self->hits      = 0;                                                                                             \
+    self->misses    = 0;                                                                                             \
+    self->evictions = 0;                                                                                             \
+    self->slots     = (struct cache_slot_##name*) block;                                                             \
+    self->index     = (size_t*) (self->slots + capacity);                                                            \
+    memset(self->index, 0, indexCap * sizeof(size_t));                                                               \
+    return true;                                                                                                     \
+}                                                                                                                    \
+                                                                                                                     \
+static inline struct __dc4c_optional_namespace_name optional_##name cache_get_##name(struct cache_##name* self,      \
+                                                                                     keyType key) {                  \
+    struct __dc4c_optional_namespace_name optional_##name toReturn;                                                  \
+    memset(&toReturn, 0, sizeof(toReturn));                                                                          \
+    const size_t slot = self->index[__dc4c_cache_find_##name(self, &key, (size_t) hashFunction(&key))];              \
+    toReturn.has_value = slot != 0;                                                                                  \
+    if (slot == 0) {                                                                                                 \
+        ++self->misses;                                                                                              \
+        return toReturn;                                                                                             \
+    }                                                                                                                \
+    ++self->hits;                                                                                                    \
+    __dc4c_cache_touch_##name(self, slot - 1);                                                                       \
+    toReturn.value = self->slots[slot - 1].value;                                                                    \
+    return toReturn;                                                                                                 \
+}                                                                                                                    \
+                                                                                                                     \
+static inline valueType* cache_peek_##name(const struct cache_##name* self, keyType key) {                           \
+    const size_t slot = self->index[__dc4c_cache_find_##name(self, &key, (size_t) hashFunction(&key))];              \
+    return slot == 0 ? NULL : &self->slots[slot - 1].value;                                                          \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void __dc4c_cache_displace_##name(const struct cache_slot_##name* entry,                               \
+                                                keyType* displacedKey, valueType* displacedValue) {                  \
+    if (displacedKey != NULL) {                                                                                      \
+        *displacedKey = entry->key;                                                                                  \
+    }                                                                                                                \
+    if (displacedValue != NULL) {                                                                                    \
+        *displacedValue = entry->value;                                                                              \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline bool cache_put_##name(struct cache_##name* self, keyType key, valueType value,                         \
+                                    keyType* displacedKey, valueType* displacedValue) {                              \
+    const size_t keyHash  = (size_t) hashFunction(&key);                                                             \
+    size_t       position = __dc4c_cache_find_##name(self, &key, keyHash);                                           \
+    size_t       slot     = self->index[position];                                                                   \
+    if (slot != 0) {                                                                                                 \
+        __dc4c_cache_displace_##name(&self->slots[slot - 1], displacedKey, displacedValue);                          \
+        self->slots[slot - 1].key   = key;                                                                           \
+        self->slots[slot - 1].value = value;                                                                         \
+        __dc4c_cache_touch_##name(self, slot - 1);                                                                   \
+        return true;                                                                                                 \
+    }                                                                                                                \
+    bool displaced = false;                                                                                          \
+    if (self->freeList != __DC4C_CACHE_NONE) {                                                                       \
+        slot           = self->freeList;                                                                             \
+        self->freeList = self->slots[slot].next;                                                                     \
+    } else if (self->fresh < self->capacity) {                                                                       \
+        slot = self->fresh++;                                                                                        \
+    } else {                                                                                                         \
+        slot      = __dc4c_cache_evict_##name(self);                                                                 \
+        position  = __dc4c_cache_find_##name(self, &key, keyHash);                                                   \
+        displaced = true;                                                                                            \
+        __dc4c_cache_displace_##name(&self->slots[slot], displacedKey, displacedValue);                              \
+    }                                                                                                                \
+    struct cache_slot_##name* entry = &self->slots[slot];                                                            \
+    entry->key        = key;                                                                                         \
+    entry->value      = value;                                                                                       \
+    entry->hash       = keyHash;                                                                                     \
+    entry->used       = true;                                                                                        \
+    entry->referenced = false;                                                                                       \
+    self->index[position] = slot + 1;                                                                                \
+    if (self->policy == CACHE_LRU) {                                                                                 \
+        __dc4c_cache_link_##name(self, slot);                                                                        \
+    }                                                                                                                \
+    ++self->count;                                                                                                   \
+    return displaced;                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline bool cache_erase_##name(struct cache_##name* self, keyType key) {                                      \
+    const size_t slot = self->index[__dc4c_cache_find_##name(self, &key, (size_t) hashFunction(&key))];              \
+    if (slot == 0) {                                                                                                 \
+        return false;                                                                                                \
+    }                                                                                                                \
+    if (self->policy == CACHE_LRU) {                                                                                 \
+        __dc4c_cache_unlink_##name(self, slot - 1);                                                                  \
+    }                                                                                                                \
+    __dc4c_cache_unindex_##name(self, slot - 1);                                                                     \
+    self->slots[slot - 1].used = false;                                                                              \
+    self->slots[slot - 1].next = self->freeList;                                                                     \
+    self->freeList             = slot - 1;                                                                           \
+    --self->count;                                                                                                   \
+    return true;                                                                                                     \
+}
+
+/**
+ * @brief Defines a cache of the given name mapping the given key type to the given value type.
+ *
+ * The cache holds up to the capacity given at its initialization. Its slots
+ * and hash index are allocated at once, afterwards no operation allocates.
+ * When the cache is full, storing a new pair evicts another one according to
+ * the policy of the cache. The cache is not thread-safe.<br>
+ * The optional of the same name needs to be defined before.<br>
+ * The following functions are defined:
+ * - @c cache_init_NAME(cache, capacity, policy) initializes the cache, returns whether the allocation succeeded
+ * - @c cache_get_NAME(cache, key) returns the value of the key as optional and marks it as used
+ * - @c cache_peek_NAME(cache, key) returns a pointer to the value of the key or @c NULL , not counting as usage
+ * - @c cache_put_NAME(cache, key, value, displacedKey, displacedValue) stores the pair, evicting if necessary,
+ *   returns whether a pair was evicted or replaced and stores it into the given pointers unless they are @c NULL
+ * - @c cache_erase_NAME(cache, key) removes the key, returns whether it was stored
+ *
+ * @param name the name of the cache and of its optional
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ * @param hash the hash function, called with a pointer to the key type
+ * @param comp the comparison function, called with two pointers to the key type
+ */
+#define typedef_cache_named(name, keyType, valueType, hash, comp) \
+__dc4c_cache_named(name, keyType, valueType);                     \
+__dc4c_cache_methods(name, keyType, valueType, hash, comp)        \
+__dc4c_cache_cxx_wrapper(name, keyType, valueType)                \
+typedef struct cache_##name cache_##name##_t
+
+/**
+ * Returns the amount of pairs stored in the given cache.
+ *
+ * @param cachePtr the pointer to the cache
+ * @return the amount of stored pairs
+ */
+#define cache_size(cachePtr) ({ (cachePtr)->count; })
+
+/**
+ * Returns the maximum amount of pairs the given cache holds.
+ *
+ * @param cachePtr the pointer to the cache
+ * @return the capacity
+ */
+#define cache_capacity(cachePtr) ({ (cachePtr)->capacity; })
+
+/**
+ * Returns the amount of lookups of the given cache that found their key.
+ *
+ * @param cachePtr the pointer to the cache
+ * @return the amount of hits
+ */
+#define cache_hits(cachePtr) ({ (cachePtr)->hits; })
+
+/**
+ * Returns the amount of lookups of the given cache that did not find their key.
+ *
+ * @param cachePtr the pointer to the cache
+ * @return the amount of misses
+ */
+#define cache_misses(cachePtr) ({ (cachePtr)->misses; })
+
+/**
+ * Returns the amount of pairs evicted from the given cache.
+ *
+ * @param cachePtr the pointer to the cache
+ * @return the amount of evictions
+ */
+#define cache_evictions(cachePtr) ({ (cachePtr)->evictions; })
+
+/**
+ * Resets the hit, miss and eviction counters of the given cache.
+ *
+ * @param cachePtr the pointer to the cache
+ */
+#define cache_reset_counters(cachePtr)              \
+do {                                                \
+    __DC4C_TYPEOF((cachePtr)) __c_crc = (cachePtr); \
+                                                    \
+    __c_crc->hits      = 0;                         \
+    __c_crc->misses    = 0;                         \
+    __c_crc->evictions = 0;                         \
+} while (0)
+
+/**
+ * @brief Removes all pairs of the given cache, keeping its memory and counters.
+ *
+ * The pairs are dropped without being visited, pairs owning memory can be
+ * released before using @c cache_forEach .
+ *
+ * @param cachePtr the pointer to the cache
+ */
+#define cache_clear(cachePtr)                                              \
+do {                                                                       \
+    __DC4C_TYPEOF((cachePtr)) __c_cc = (cachePtr);                         \
+                                                                           \
+    __c_cc->count    = 0;                                                  \
+    __c_cc->fresh    = 0;                                                  \
+    __c_cc->freeList = __DC4C_CACHE_NONE;                                  \
+    __c_cc->head     = __DC4C_CACHE_NONE;                                  \
+    __c_cc->tail     = __DC4C_CACHE_NONE;                                  \
+    __c_cc->hand     = 0;                                                  \
+    memset(__c_cc->index, 0, (__c_cc->mask + 1) * sizeof(*__c_cc->index)); \
+} while (0)
+
+/**
+ * @brief Iterates over the pairs of the given cache.
+ *
+ * The pairs are visited in no particular order and are not marked as used.
+ * The block may leave the iteration using @c break . The cache must not be
+ * modified during the iteration, except for the values.
+ *
+ * @param cachePtr the pointer to the cache
+ * @param keyName the name of the variable holding a pointer to the current key
+ * @param valueName the name of the variable holding a pointer to the current value
+ * @param block the block to be executed
+ */
+#define cache_forEach(cachePtr, keyName, valueName, block)                                           \
+do {                                                                                                 \
+    __DC4C_TYPEOF((cachePtr)) __c_cfe = (cachePtr);                                                  \
+                                                                                                     \
+    for (size_t __dc4c_i = 0; __dc4c_i < __c_cfe->fresh; ++__dc4c_i) {                               \
+        if (!__c_cfe->slots[__dc4c_i].used) {                                                        \
+            continue;                                                                                \
+        }                                                                                            \
+        const __DC4C_VALUE_TYPEOF(__c_cfe->slots->key)* keyName   = &__c_cfe->slots[__dc4c_i].key;   \
+        __DC4C_VALUE_TYPEOF(__c_cfe->slots->value)*     valueName = &__c_cfe->slots[__dc4c_i].value; \
+        (void) keyName;                                                                              \
+        (void) valueName;                                                                            \
+        { block }                                                                                    \
+    }                                                                                                \
+} while (0)
+
+/**
+ * Destroys the given cache.
+ *
+ * @param cachePtr the pointer to the cache
+ */
+#define cache_destroy(cachePtr) free((cachePtr)->slots)
+
+/**
+ * @brief Destroys the given cache and its pairs.
+ *
+ * Calls the given function with the key and the value of each pair stored in
+ * the given cache. The cache must be initialized again before being used.
+ *
+ * @param cachePtr the pointer to the cache
+ * @param pairFunc the function to destroy the keys and the values
+ */
+#define cache_destroyWith(cachePtr, pairFunc)                    \
+do {                                                             \
+    __DC4C_TYPEOF((cachePtr)) __c_cdw = (cachePtr);              \
+                                                                 \
+    cache_forEach(__c_cdw, key, value, pairFunc(*key, *value);); \
+    cache_destroy(__c_cdw);                                      \
+} while (0)
+
+#ifdef __cplusplus
+# include "cache.hpp"
+#endif
+
+#ifndef __dc4c_cache_cxx_wrapper
+# define __dc4c_cache_cxx_wrapper(name, keyType, valueType)
+#endif
+
+#endif /* __DC4C_cache_h */
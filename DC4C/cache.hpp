@@ -0,0 +1,278 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_cache_h
+# warning Wrong inclusion of "cache.hpp" redirected to #include "cache.h"!
+# include "cache.h"
+#else
+# ifndef __DC4C_cache_hpp
+# define __DC4C_cache_hpp
+
+# include <new>
+
+namespace dc4c {
+/**
+ * The functions of a C cache, specialized by @c typedef_cache_named .
+ *
+ * @tparam T the C DC4C cache type
+ */
+template<typename T>
+struct cache_traits;
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for the C cache of DC4C.
+ *
+ * @tparam T the C DC4C cache type to be managed by this wrapper class
+ */
+template<typename T>
+class cache {
+    /** The functions of the C cache. */
+    using traits = cache_traits<T>;
+
+    /** The underlying C cache. */
+    T underlying;
+
+public:
+    /** The type used for the size of the cache. */
+    using size_type = std::size_t;
+    /** The type of the keys.                     */
+    using key_type = typename traits::key_type;
+    /** The type of the values.                   */
+    using mapped_type = typename traits::mapped_type;
+    /** The type of the optional values.          */
+    using optional_type = typename traits::optional_type;
+
+    /**
+     * Constructs a cache of the given capacity.
+     *
+     * @param capacity the maximum amount of stored pairs
+     * @param policy the eviction policy
+     * @throw std::bad_alloc if the allocation failed or the capacity is zero
+     */
+    inline explicit cache(size_type capacity, cache_policy policy = CACHE_LRU) {
+        if (!traits::init(&underlying, capacity, policy)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    cache(const cache&) = delete;
+
+    inline ~cache() {
+        cache_destroy(&underlying);
+    }
+
+    auto operator=(const cache&) -> cache& = delete;
+
+    /**
+     * @brief Returns the underlying C cache.
+     *
+     * @return the underlying C cache
+     */
+    __DC4C_CONSTEXPR_SINCE_CXX14 inline auto data() noexcept -> T& {
+        return underlying;
+    }
+
+    /**
+     * Returns the value of the given key and marks it as used.
+     *
+     * @param key the key
+     * @return the optional value
+     */
+    inline auto get(const key_type& key) noexcept -> optional_type {
+        return traits::get(&underlying, key);
+    }
+
+    /**
+     * Returns the value of the given key without marking it as used.
+     *
+     * @param key the key
+     * @return a pointer to the value or @c nullptr if the key is not stored
+     */
+    inline auto peek(const key_type& key) const noexcept -> mapped_type* {
+        return traits::peek(&underlying, key);
+    }
+
+    /**
+     * Stores or replaces the value of the given key, evicting another pair if the cache is full.
+     *
+     * @param key the key
+     * @param value the value
+     * @return whether a pair was evicted or replaced
+     */
+    inline auto put(const key_type& key, const mapped_type& value) noexcept -> bool {
+        return traits::put(&underlying, key, value, nullptr, nullptr);
+    }
+
+    /**
+     * @brief Stores or replaces the value of the given key, evicting another pair if the cache is full.
+     *
+     * The evicted or replaced pair is stored into the given references.
+     *
+     * @param key the key
+     * @param value the value
+     * @param displacedKey the key of the evicted or replaced pair
+     * @param displacedValue the value of the evicted or replaced pair
+     * @return whether a pair was evicted or replaced
+     */
+    inline auto put(const key_type& key, const mapped_type& value,
+                    key_type& displacedKey, mapped_type& displacedValue) noexcept -> bool {
+        return traits::put(&underlying, key, value, &displacedKey, &displacedValue);
+    }
+
+    /**
+     * Removes the given key.
+     *
+     * @param key the key
+     * @return whether the key was stored
+     */
+    inline auto erase(const key_type& key) noexcept -> bool {
+        return traits::erase(&underlying, key);
+    }
+
+    /**
+     * Removes all pairs, keeping the counters.
+     */
+    inline void clear() noexcept {
+        cache_clear(&underlying);
+    }
+
+    /**
+     * Calls the given function with the key and the value of each pair and removes all pairs, keeping the counters.
+     *
+     * @tparam F the type of the function
+     * @param function the function to be called with each key and value
+     */
+    template<typename F>
+    inline void clear(F&& function) {
+        cache_forEach(&underlying, key, value, {
+            function(*key, *value);
+        });
+        cache_clear(&underlying);
+    }
+
+    /**
+     * Calls the given function with the key and the value of each pair, in no particular order.
+     *
+     * @tparam F the type of the function
+     * @param function the function to be called with each key and value
+     */
+    template<typename F>
+    inline void for_each(F&& function) {
+        cache_forEach(&underlying, key, value, {
+            function(*key, *value);
+        });
+    }
+
+    /**
+     * Resets the hit, miss and eviction counters.
+     */
+    inline void reset_counters() noexcept {
+        cache_reset_counters(&underlying);
+    }
+
+    /**
+     * Returns the amount of stored pairs.
+     *
+     * @return the amount of stored pairs
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.count;
+    }
+
+    /**
+     * Returns the maximum amount of stored pairs.
+     *
+     * @return the capacity
+     */
+    constexpr inline auto capacity() const noexcept -> size_type {
+        return underlying.capacity;
+    }
+
+    /**
+     * Returns the amount of lookups that found their key.
+     *
+     * @return the amount of hits
+     */
+    constexpr inline auto hits() const noexcept -> size_type {
+        return underlying.hits;
+    }
+
+    /**
+     * Returns the amount of lookups that did not find their key.
+     *
+     * @return the amount of misses
+     */
+    constexpr inline auto misses() const noexcept -> size_type {
+        return underlying.misses;
+    }
+
+    /**
+     * Returns the amount of evicted pairs.
+     *
+     * @return the amount of evictions
+     */
+    constexpr inline auto evictions() const noexcept -> size_type {
+        return underlying.evictions;
+    }
+};
+}
+
+/**
+ * Defines the C++ wrapper of the cache of the given name.
+ *
+ * @param name the name of the C cache
+ * @param keyType the type of the keys
+ * @param valueType the type of the values
+ */
+# define __dc4c_cache_cxx_wrapper(name, keyType, valueType)                                            \
+namespace dc4c {                                                                                       \
+template<>                                                                                             \
+struct cache_traits<::cache_##name> {                                                                  \
+    using key_type      = keyType;                                                                     \
+    using mapped_type   = valueType;                                                                   \
+    using optional_type = dc4c::optional_##name;                                                       \
+                                                                                                       \
+    static inline auto init(::cache_##name* self, std::size_t capacity, cache_policy policy) -> bool { \
+        return cache_init_##name(self, capacity, policy);                                              \
+    }                                                                                                  \
+                                                                                                       \
+    static inline auto get(::cache_##name* self, const key_type& key) -> optional_type {               \
+        return cache_get_##name(self, key);                                                            \
+    }                                                                                                  \
+                                                                                                       \
+    static inline auto peek(const ::cache_##name* self, const key_type& key) -> mapped_type* {         \
+        return cache_peek_##name(self, key);                                                           \
+    }                                                                                                  \
+                                                                                                       \
+    static inline auto put(::cache_##name* self, const key_type& key, const mapped_type& value,        \
+                           key_type* displacedKey, mapped_type* displacedValue) -> bool {              \
+        return cache_put_##name(self, key, value, displacedKey, displacedValue);                       \
+    }                                                                                                  \
+                                                                                                       \
+    static inline auto erase(::cache_##name* self, const key_type& key) -> bool {                      \
+        return cache_erase_##name(self, key);                                                          \
+    }                                                                                                  \
+};                                                                                                     \
+}                                                                                                      \
+namespace dc4c {                                                                                       \
+using cache_##name = cache<::cache_##name>;                                                            \
+}
+
+# endif /* __DC4C_cache_hpp */
+#endif /* !__DC4C_cache_h */
@@ -0,0 +1,483 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_compressed_vector_h
+#define __DC4C_compressed_vector_h
+
+#if __STDC_VERSION__ < 202311L
+# include <stdbool.h>
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vector.h"
+
+/** The amount of values encoded together in one block. */
+#define COMPRESSED_VECTOR_BLOCK_SIZE 128
+
+/** The amount of padding bytes behind the encoded data, allowing unaligned word loads. */
+#define __DC4C_COMPRESSED_VECTOR_PADDING 16
+
+/**
+ * The encodings available for compressed vectors.
+ */
+enum compressed_vector_encoding {
+    /** Frame of reference: each value is bit-packed as its offset to the minimum of its block. */
+    COMPRESSED_VECTOR_BITPACK,
+    /** Each value is stored as LEB128 varint of its difference to its predecessor in its block. */
+    COMPRESSED_VECTOR_DELTA_VARINT
+};
+
+/**
+ * The skip pointer of one block of a compressed vector.
+ */
+struct __dc4c_compressed_vector_block {
+    /** The minimum value of the block when bit-packed, its first value otherwise. */
+    uint64_t base;
+    /** The offset of the encoded data of the block.                             */
+    size_t   offset;
+    /** The amount of bits used per value when bit-packed.                       */
+    unsigned width;
+};
+
+/**
+ * @brief The compressed vector structure.
+ *
+ * A compressed vector stores unsigned integers of up to 64 bits in blocks of
+ * @c COMPRESSED_VECTOR_BLOCK_SIZE values. Each block is reachable directly by
+ * its skip pointer.
+ */
+struct compressed_vector {
+    /** The amount of stored values.           */
+    size_t                                 count;
+    /** The encoding of the values.            */
+    enum compressed_vector_encoding        encoding;
+    /** The amount of encoded blocks.          */
+    size_t                                 blockCount;
+    /** The amount of allocated skip pointers. */
+    size_t                                 blockCap;
+    /** The skip pointers of the blocks.       */
+    struct __dc4c_compressed_vector_block* blocks;
+    /** The amount of used bytes.              */
+    size_t                                 bytes;
+    /** The amount of allocated bytes.         */
+    size_t                                 cap;
+    /** The encoded values.                    */
+    unsigned char*                         content;
+};
+
+typedef struct compressed_vector compressed_vector_t;
+
+/**
+ * The initial values for a compressed vector.
+ *
+ * @param encoding the encoding to be used
+ */
+#define compressed_vector_initializer(encoding) { 0, (encoding), 0, 0, NULL, 0, 0, NULL }
+
+/**
+ * Loads the little endian 64 bit word at the given address.
+ *
+ * @param bytes the address of the word
+ * @return the loaded word
+ */
+static inline uint64_t __dc4c_compressed_vector_load(const unsigned char* bytes) {
+    uint64_t toReturn;
+    memcpy(&toReturn, bytes, sizeof(toReturn));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    toReturn = __builtin_bswap64(toReturn);
+#endif
+    return toReturn;
+}
+
+/**
+ * Makes sure the given compressed vector can hold the given amount of
+ * additional bytes plus the padding.
+ *
+ * @param self the compressed vector
+ * @param additional the amount of additional bytes
+ * @return whether enough memory is available
+ */
+static inline bool __dc4c_compressed_vector_reserve(struct compressed_vector* self, size_t additional) {
+    const size_t needed = self->bytes + additional + __DC4C_COMPRESSED_VECTOR_PADDING;
+    if (self->cap >= needed) {
+        return true;
+    }
+
+    size_t newCap = self->cap == 0 ? 256 : self->cap * 2;
+    if (newCap < needed) {
+        newCap = needed;
+    }
+    unsigned char* tmp = (unsigned char*) realloc(self->content, newCap);
+    if (tmp == NULL) {
+        return false;
+    }
+    memset(tmp + self->cap, 0, newCap - self->cap);
+    self->content = tmp;
+    self->cap     = newCap;
+    return true;
+}
+
+/**
+ * @brief Encodes the given values as new block at the end of the given compressed vector.
+ *
+ * If the allocation failed, the content of the given compressed vector is
+ * left unchanged. The last block must be complete before a new one is added.
+ *
+ * @param self the compressed vector
+ * @param values the values to be encoded
+ * @param count the amount of values, at most @c COMPRESSED_VECTOR_BLOCK_SIZE
+ * @return whether the block was added successfully
+ */
+static inline bool __dc4c_compressed_vector_append_block(struct compressed_vector* self,
+                                                         const uint64_t*           values,
+                                                         size_t                    count) {
+    if (self->blockCap < self->blockCount + 1) {
+        const size_t newCap = self->blockCap == 0 ? 16 : self->blockCap * 2;
+        struct __dc4c_compressed_vector_block* tmp = (struct __dc4c_compressed_vector_block*)
+            realloc(self->blocks, sizeof(*self->blocks) * newCap);
+        if (tmp == NULL) {
+            return false;
+        }
+        self->blocks   = tmp;
+        self->blockCap = newCap;
+    }
+
+    struct __dc4c_compressed_vector_block block = { values[0], self->bytes, 0 };
+    if (self->encoding == COMPRESSED_VECTOR_BITPACK) {
+        uint64_t max = values[0];
+        for (size_t i = 1; i < count; ++i) {
+            if (values[i] < block.base) block.base = values[i];
+            if (values[i] > max)        max        = values[i];
+        }
+        const uint64_t range = max - block.base;
+        block.width = range == 0 ? 0 : 64 - (unsigned) __builtin_clzll((unsigned long long) range);
+
+        const size_t bytes = (count * block.width + 7) / 8;
+        if (!__dc4c_compressed_vector_reserve(self, bytes)) {
+            return false;
+        }
+        unsigned char* out = self->content + self->bytes;
+        uint64_t acc  = 0;
+        unsigned bits = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t value = values[i] - block.base;
+            acc |= value << bits;
+            if (bits + block.width >= 64) {
+                for (unsigned b = 0; b < 8; ++b) *out++ = (unsigned char) (acc >> (8 * b));
+                acc  = bits == 0 ? 0 : value >> (64 - bits);
+                bits = bits + block.width - 64;
+            } else {
+                bits += block.width;
+            }
+        }
+        for (; bits > 0; bits = bits > 8 ? bits - 8 : 0, acc >>= 8) {
+            *out++ = (unsigned char) acc;
+        }
+        self->bytes += bytes;
+    } else {
+        if (!__dc4c_compressed_vector_reserve(self, (count - 1) * 10)) {
+            return false;
+        }
+        unsigned char* out = self->content + self->bytes;
+        for (size_t i = 1; i < count; ++i) {
+            uint64_t delta = values[i] - values[i - 1];
+            while (delta >= 0x80) {
+                *out++ = (unsigned char) (delta | 0x80);
+                delta >>= 7;
+            }
+            *out++ = (unsigned char) delta;
+        }
+        self->bytes = (size_t) (out - self->content);
+    }
+    self->blocks[self->blockCount++] = block;
+    self->count += count;
+    return true;
+}
+
+/**
+ * Decodes the values of the given block in the given compressed vector.
+ *
+ * @param self the compressed vector
+ * @param blockIndex the index of the block
+ * @param until the amount of values to be decoded at most
+ * @param out the buffer receiving the decoded values
+ * @return the amount of decoded values
+ */
+static inline size_t __dc4c_compressed_vector_decode(const struct compressed_vector* self,
+                                                     size_t                          blockIndex,
+                                                     size_t                          until,
+                                                     uint64_t*                       out) {
+    size_t count = self->count - blockIndex * COMPRESSED_VECTOR_BLOCK_SIZE;
+    if (count > COMPRESSED_VECTOR_BLOCK_SIZE) count = COMPRESSED_VECTOR_BLOCK_SIZE;
+    if (count > until)                        count = until;
+
+    const struct __dc4c_compressed_vector_block* block = &self->blocks[blockIndex];
+    const unsigned char* in = self->content + block->offset;
+    if (self->encoding == COMPRESSED_VECTOR_BITPACK) {
+        const unsigned width = block->width;
+        const uint64_t mask  = width == 64 ? ~UINT64_C(0) : (UINT64_C(1) << width) - 1;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t   bit   = i * width;
+            const unsigned shift = (unsigned) (bit % 8);
+            uint64_t word = __dc4c_compressed_vector_load(in + bit / 8) >> shift;
+            if (shift + width > 64) {
+                word |= (uint64_t) in[bit / 8 + 8] << (64 - shift);
+            }
+            out[i] = block->base + (word & mask);
+        }
+    } else if (count > 0) {
+        uint64_t value = block->base;
+        out[0] = value;
+        for (size_t i = 1; i < count; ++i) {
+            uint64_t delta = 0;
+            unsigned shift = 0;
+            unsigned char byte;
+            do {
+                byte   = *in++;
+                delta |= (uint64_t) (byte & 0x7f) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+            value += delta;
+            out[i] = value;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Returns the value at the given position.
+ *
+ * @param self the compressed vector
+ * @param position the position in the range [0 ... size - 1]
+ * @return the value at the given position
+ */
+static inline uint64_t __dc4c_compressed_vector_at(const struct compressed_vector* self, size_t position) {
+    const size_t blockIndex = position / COMPRESSED_VECTOR_BLOCK_SIZE;
+    const size_t inBlock    = position % COMPRESSED_VECTOR_BLOCK_SIZE;
+
+    if (self->encoding == COMPRESSED_VECTOR_BITPACK) {
+        const struct __dc4c_compressed_vector_block* block = &self->blocks[blockIndex];
+        const unsigned width = block->width;
+        const uint64_t mask  = width == 64 ? ~UINT64_C(0) : (UINT64_C(1) << width) - 1;
+        const unsigned char* in = self->content + block->offset;
+        const size_t   bit   = inBlock * width;
+        const unsigned shift = (unsigned) (bit % 8);
+        uint64_t word = __dc4c_compressed_vector_load(in + bit / 8) >> shift;
+        if (shift + width > 64) {
+            word |= (uint64_t) in[bit / 8 + 8] << (64 - shift);
+        }
+        return block->base + (word & mask);
+    }
+    uint64_t buffer[COMPRESSED_VECTOR_BLOCK_SIZE];
+    __dc4c_compressed_vector_decode(self, blockIndex, inBlock + 1, buffer);
+    return buffer[inBlock];
+}
+
+/**
+ * @brief Searches the first value not less than the given value.
+ *
+ * The compressed vector must be sorted in ascending order.
+ *
+ * @param self the compressed vector
+ * @param value the searched value
+ * @return the position of the found value or the size if all values are less
+ */
+static inline size_t __dc4c_compressed_vector_lower_bound(const struct compressed_vector* self, uint64_t value) {
+    size_t low  = 0,
+           high = self->blockCount;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (self->blocks[middle].base < value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low == 0) {
+        return 0;
+    }
+
+    uint64_t buffer[COMPRESSED_VECTOR_BLOCK_SIZE];
+    const size_t count = __dc4c_compressed_vector_decode(self, low - 1, COMPRESSED_VECTOR_BLOCK_SIZE, buffer);
+    size_t i = 0;
+    while (i < count && buffer[i] < value) {
+        ++i;
+    }
+    return (low - 1) * COMPRESSED_VECTOR_BLOCK_SIZE + i;
+}
+
+/**
+ * @brief Builds the given compressed vector from the given DC4C vector.
+ *
+ * The given compressed vector must be empty and initialized with the desired
+ * encoding. The given vector has to contain unsigned integers. If the
+ * allocation failed, the compressed vector holds the values of the blocks
+ * encoded so far.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @param vectorPtr the pointer to the DC4C vector to be compressed
+ * @return whether all values were encoded successfully
+ */
+#define compressed_vector_build(compressedPtr, vectorPtr) ({                                             \
+    bool __cvb_result = true;                                                                            \
+    do {                                                                                                 \
+        compressed_vector_t*       __cv_cvb = (compressedPtr);                                           \
+        __DC4C_TYPEOF((vectorPtr)) __v_cvb  = (vectorPtr);                                               \
+                                                                                                         \
+        uint64_t __b_cvb[COMPRESSED_VECTOR_BLOCK_SIZE];                                                  \
+        for (size_t __dc4c_i = 0; __dc4c_i < __v_cvb->count; __dc4c_i += COMPRESSED_VECTOR_BLOCK_SIZE) { \
+            size_t __n_cvb = __v_cvb->count - __dc4c_i;                                                  \
+            if (__n_cvb > COMPRESSED_VECTOR_BLOCK_SIZE) __n_cvb = COMPRESSED_VECTOR_BLOCK_SIZE;          \
+            for (size_t __dc4c_j = 0; __dc4c_j < __n_cvb; ++__dc4c_j) {                                  \
+                __b_cvb[__dc4c_j] = (uint64_t) __v_cvb->content[__dc4c_i + __dc4c_j];                    \
+            }                                                                                            \
+            if (!__dc4c_compressed_vector_append_block(__cv_cvb, __b_cvb, __n_cvb)) {                    \
+                __cvb_result = false;                                                                    \
+                break;                                                                                   \
+            }                                                                                            \
+        }                                                                                                \
+    } while (0);                                                                                         \
+    __cvb_result;                                                                                        \
+})
+
+/**
+ * @brief Decompresses the given compressed vector into the given DC4C vector.
+ *
+ * The values are appended to the given vector. If the allocation failed, the
+ * content of the given vector is left unchanged.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @param vectorPtr the pointer to the DC4C vector receiving the values
+ * @return whether the values were decompressed successfully
+ */
+#define compressed_vector_decompress(compressedPtr, vectorPtr) ({                                \
+    bool __cvd_result = false;                                                                   \
+    do {                                                                                         \
+        const compressed_vector_t* __cv_cvd = (compressedPtr);                                   \
+        __DC4C_TYPEOF((vectorPtr)) __v_cvd  = (vectorPtr);                                       \
+                                                                                                 \
+        if (!vector_reserve(__v_cvd, __v_cvd->count + __cv_cvd->count)) {                        \
+            break;                                                                               \
+        }                                                                                        \
+        uint64_t __b_cvd[COMPRESSED_VECTOR_BLOCK_SIZE];                                          \
+        for (size_t __dc4c_b = 0; __dc4c_b < __cv_cvd->blockCount; ++__dc4c_b) {                 \
+            const size_t __n_cvd = __dc4c_compressed_vector_decode(__cv_cvd, __dc4c_b,           \
+                                                                   COMPRESSED_VECTOR_BLOCK_SIZE, \
+                                                                   __b_cvd);                     \
+            for (size_t __dc4c_i = 0; __dc4c_i < __n_cvd; ++__dc4c_i) {                          \
+                __v_cvd->content[__v_cvd->count++] =                                             \
+                    (__DC4C_TYPEOF(*__v_cvd->content)) __b_cvd[__dc4c_i];                        \
+            }                                                                                    \
+        }                                                                                        \
+        __cvd_result = true;                                                                     \
+    } while (0);                                                                                 \
+    __cvd_result;                                                                                \
+})
+
+/**
+ * @brief Returns the value at the given position.
+ *
+ * Bit-packed values are accessed directly, delta encoded values are decoded
+ * from the beginning of their block. The given position must be in the range
+ * [0 ... size - 1].
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @param position the position of the value
+ * @return the value at the given position
+ */
+#define compressed_vector_at(compressedPtr, position) \
+    __dc4c_compressed_vector_at((compressedPtr), (size_t) (position))
+
+/**
+ * @brief Searches the first value not less than the given value.
+ *
+ * The compressed vector must be sorted in ascending order. The blocks are
+ * searched using their skip pointers, only one block is decoded.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @param value the searched value
+ * @return the position of the found value or the size if all values are less
+ */
+#define compressed_vector_lower_bound(compressedPtr, value) \
+    __dc4c_compressed_vector_lower_bound((compressedPtr), (uint64_t) (value))
+
+/**
+ * Decodes the given compressed vector block by block and executes the given
+ * block of code for each of its values.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @param varname the name of the iteration variable, pointing to the decoded value
+ * @param block the code to execute for each value
+ */
+#define compressed_vector_forEach(compressedPtr, varname, block)                              \
+do {                                                                                          \
+    const compressed_vector_t* __cv_cvfe = (compressedPtr);                                   \
+                                                                                              \
+    uint64_t __b_cvfe[COMPRESSED_VECTOR_BLOCK_SIZE];                                          \
+    for (size_t __dc4c_b = 0; __dc4c_b < __cv_cvfe->blockCount; ++__dc4c_b) {                 \
+        const size_t __n_cvfe = __dc4c_compressed_vector_decode(__cv_cvfe, __dc4c_b,          \
+                                                                COMPRESSED_VECTOR_BLOCK_SIZE, \
+                                                                __b_cvfe);                    \
+        for (size_t __dc4c_i = 0; __dc4c_i < __n_cvfe; ++__dc4c_i) {                          \
+            const uint64_t* varname = &__b_cvfe[__dc4c_i];                                    \
+            { block }                                                                         \
+        }                                                                                     \
+    }                                                                                         \
+} while (0)
+
+/**
+ * Returns the amount of values held by the given compressed vector.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @return the amount of values in the given compressed vector
+ */
+#define compressed_vector_size(compressedPtr) ({ (compressedPtr)->count; })
+
+/**
+ * Returns the amount of bytes used by the encoded values and skip pointers of
+ * the given compressed vector.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ * @return the amount of used bytes
+ */
+#define compressed_vector_memory(compressedPtr) ({                      \
+    const compressed_vector_t* __cv_cvm = (compressedPtr);              \
+    __cv_cvm->bytes + __cv_cvm->blockCount * sizeof(*__cv_cvm->blocks); \
+})
+
+/**
+ * @brief Destroys the given compressed vector.
+ *
+ * The destroyed compressed vector must be reconstructed before being used
+ * again.
+ *
+ * @param compressedPtr the pointer to the compressed vector
+ */
+#define compressed_vector_destroy(compressedPtr)      \
+do {                                                  \
+    compressed_vector_t* __cv_cvde = (compressedPtr); \
+                                                      \
+    free(__cv_cvde->blocks);                          \
+    free(__cv_cvde->content);                         \
+} while (0)
+
+#ifdef __cplusplus
+# include "compressed_vector.hpp"
+#endif
+
+#endif /* __DC4C_compressed_vector_h */
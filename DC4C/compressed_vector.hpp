@@ -0,0 +1,165 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_compressed_vector_h
+# warning Wrong inclusion of "compressed_vector.hpp" redirected to #include "compressed_vector.h"!
+# include "compressed_vector.h"
+#else
+# ifndef __DC4C_compressed_vector_hpp
+# define __DC4C_compressed_vector_hpp
+
+# include <cstdint>
+# include <new>
+# include <vector>
+
+namespace dc4c {
+/**
+ * This class acts as a RAII compatible wrapper class for the C compressed
+ * vector of DC4C.
+ */
+class compressed_vector {
+    /** The underlying C compressed vector. */
+    compressed_vector_t underlying;
+
+public:
+    /** The type used for the size of the compressed vector. */
+    using size_type = std::size_t;
+    /** The type of the stored values.                       */
+    using value_type = std::uint64_t;
+
+    /**
+     * Constructs an empty compressed vector.
+     *
+     * @param encoding the encoding to be used
+     */
+    inline explicit compressed_vector(compressed_vector_encoding encoding = COMPRESSED_VECTOR_BITPACK)
+        : underlying(compressed_vector_initializer(encoding)) {}
+
+    /**
+     * Compresses the given DC4C C vector.
+     *
+     * @tparam T the type of the C vector
+     * @param cVector the C vector to be compressed
+     * @param encoding the encoding to be used
+     * @throw std::bad_alloc if the allocation failed
+     */
+    template<typename T>
+    inline compressed_vector(const T& cVector, compressed_vector_encoding encoding = COMPRESSED_VECTOR_BITPACK)
+        : underlying(compressed_vector_initializer(encoding)) {
+        if (!compressed_vector_build(&underlying, &cVector)) {
+            compressed_vector_destroy(&underlying);
+            throw std::bad_alloc();
+        }
+    }
+
+    compressed_vector(const compressed_vector&) = delete;
+
+    inline compressed_vector(compressed_vector&& other) noexcept: underlying(other.underlying) {
+        other.underlying = compressed_vector_initializer(underlying.encoding);
+    }
+
+    inline ~compressed_vector() {
+        compressed_vector_destroy(&underlying);
+    }
+
+    auto operator=(const compressed_vector&) -> compressed_vector& = delete;
+
+    inline auto operator=(compressed_vector&& other) noexcept -> compressed_vector& {
+        compressed_vector_destroy(&underlying);
+        underlying = other.underlying;
+        other.underlying = compressed_vector_initializer(underlying.encoding);
+        return *this;
+    }
+
+    /**
+     * Returns the underlying C compressed vector.
+     *
+     * @return the underlying C compressed vector
+     */
+    constexpr inline auto data() const -> const compressed_vector_t& {
+        return underlying;
+    }
+
+    inline operator std::vector<value_type>() const {
+        auto toReturn = std::vector<value_type>();
+        toReturn.reserve(size());
+        compressed_vector_forEach(&underlying, value, {
+            toReturn.push_back(*value);
+        });
+        return toReturn;
+    }
+
+    /**
+     * @brief Returns the value at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     * @return the value at the given position
+     */
+    inline auto operator[](size_type position) const noexcept -> value_type {
+        return compressed_vector_at(&underlying, position);
+    }
+
+    /**
+     * Searches the first value not less than the given value in this sorted
+     * compressed vector.
+     *
+     * @param value the searched value
+     * @return the position of the found value or the size if all values are less
+     */
+    inline auto lower_bound(value_type value) const noexcept -> size_type {
+        return compressed_vector_lower_bound(&underlying, value);
+    }
+
+    /**
+     * Calls the given function for each value in order.
+     *
+     * @tparam F the type of the function
+     * @param function the function to be called with each value
+     */
+    template<typename F>
+    inline void for_each(F&& function) const {
+        compressed_vector_forEach(&underlying, value, {
+            function(*value);
+        });
+    }
+
+    /**
+     * Returns the amount of values held by this compressed vector.
+     *
+     * @return the amount of values
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.count;
+    }
+
+    /**
+     * Returns the amount of bytes used by the encoded values.
+     *
+     * @return the amount of used bytes
+     */
+    inline auto memory() const noexcept -> size_type {
+        return compressed_vector_memory(&underlying);
+    }
+};
+}
+
+# endif /* __DC4C_compressed_vector_hpp */
+#endif /* !__DC4C_compressed_vector_h */
@@ -0,0 +1,412 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_heap_h
+#define __DC4C_heap_h
+
+#include <stdint.h>
+
+#include "vector.h"
+
+/**
+ * The amount of children of each node in the heaps. Can be defined before
+ * including this header.
+ */
+#ifndef DC4C_HEAP_ARITY
+# define DC4C_HEAP_ARITY 4
+#endif
+
+/**
+ * Defines the heap structure.
+ *
+ * @param name the name of the heap and of its underlying vector
+ */
+#define __dc4c_heap_named(name)  \
+struct heap_##name {             \
+    struct vector_##name vector; \
+}
+
+/**
+ * @brief Defines the functions of the heap.
+ *
+ * The given comparison function is called with two pointers to the contained
+ * type, the same way as the comparison function of @c vector_sort . It is
+ * called directly, allowing the compiler to inline it.
+ *
+ * @param name the name of the heap
+ * @param type the contained type
+ * @param comp the comparison function
+ */
+#define __dc4c_heap_methods(name, type, comp)                                                               \
+static inline void __dc4c_heap_sift_up_##name(type* content, size_t position, type value) {                 \
+    while (position > 0) {                                                                                  \
+        const size_t parent = (position - 1) / DC4C_HEAP_ARITY;                                             \
+        if (!(comp(&content[parent], &value) < 0)) {                                                        \
+            break;                                                                                          \
+        }                                                                                                   \
+        content[position] = content[parent];                                                                \
+        position = parent;                                                                                  \
+    }                                                                                                       \
+    content[position] = value;                                                                              \
+}                                                                                                           \
+                                                                                                            \
+static inline void __dc4c_heap_sift_down_##name(type* content, size_t count, size_t position, type value) { \
+    for (;;) {                                                                                              \
+        const size_t first = position * DC4C_HEAP_ARITY + 1;                                                \
+        if (first >= count) {                                                                               \
+            break;                                                                                          \
+        }                                                                                                   \
+        const size_t last = count - first < DC4C_HEAP_ARITY ? count : first + DC4C_HEAP_ARITY;              \
+        size_t best = first;                                                                                \
+        for (size_t child = first + 1; child < last; ++child) {                                             \
+            if (comp(&content[best], &content[child]) < 0) {                                                \
+                best = child;                                                                               \
+            }                                                                                               \
+        }                                                                                                   \
+        if (!(comp(&value, &content[best]) < 0)) {                                                          \
+            break;                                                                                          \
+        }                                                                                                   \
+        content[position] = content[best];                                                                  \
+        position = best;                                                                                    \
+    }                                                                                                       \
+    content[position] = value;                                                                              \
+}                                                                                                           \
+                                                                                                            \
+static inline bool heap_push_##name(struct heap_##name* self, type value) {                                 \
+    if (!vector_push_back(&self->vector, value)) {                                                          \
+        return false;                                                                                       \
+    }                                                                                                       \
+    __dc4c_heap_sift_up_##name(self->vector.content, self->vector.count - 1, value);                        \
+    return true;                                                                                            \
+}                                                                                                           \
+                                                                                                            \
+static inline type heap_top_##name(const struct heap_##name* self) {                                        \
+    return self->vector.content[0];                                                                         \
+}                                                                                                           \
+                                                                                                            \
+static inline type heap_pop_##name(struct heap_##name* self) {                                              \
+    type toReturn = self->vector.content[0];                                                                \
+    type last     = vector_pop_back(&self->vector);                                                         \
+    if (self->vector.count > 0) {                                                                           \
+        __dc4c_heap_sift_down_##name(self->vector.content, self->vector.count, 0, last);                    \
+    }                                                                                                       \
+    return toReturn;                                                                                        \
+}                                                                                                           \
+                                                                                                            \
+static inline type heap_replace_top_##name(struct heap_##name* self, type value) {                          \
+    type toReturn = self->vector.content[0];                                                                \
+    __dc4c_heap_sift_down_##name(self->vector.content, self->vector.count, 0, value);                       \
+    return toReturn;                                                                                        \
+}                                                                                                           \
+                                                                                                            \
+static inline void heap_make_##name(struct heap_##name* self, struct vector_##name* vector) {               \
+    vector_destroy(&self->vector);                                                                          \
+    self->vector = *vector;                                                                                 \
+    vector_init(vector);                                                                                    \
+                                                                                                            \
+    const size_t count = self->vector.count;                                                                \
+    if (count < 2) {                                                                                        \
+        return;                                                                                             \
+    }                                                                                                       \
+    for (size_t i = (count - 2) / DC4C_HEAP_ARITY + 1; i-- > 0;) {                                          \
+        __dc4c_heap_sift_down_##name(self->vector.content, count, i, self->vector.content[i]);              \
+    }                                                                                                       \
+}
+
+/**
+ * @brief Defines a heap of the given name containing the given type.
+ *
+ * The heap is a d-ary max heap, the arity is defined by @c DC4C_HEAP_ARITY .
+ * Its elements are stored in a DC4C vector of the same name, which needs to be
+ * defined before. The element comparing greatest using the given comparison
+ * function is on top of the heap.<br>
+ * The following functions are defined:
+ * - @c heap_push_NAME(heap, value) adds a value and returns whether it was added
+ * - @c heap_top_NAME(heap) returns the top value
+ * - @c heap_pop_NAME(heap) removes and returns the top value
+ * - @c heap_replace_top_NAME(heap, value) replaces the top value and returns it
+ * - @c heap_make_NAME(heap, vector) takes over the vector and heapifies it in O(n)
+ *
+ * @param name the name of the heap
+ * @param type the contained type
+ * @param comp the comparison function, called with two pointers to the contained type
+ */
+#define typedef_heap_named(name, type, comp) \
+__dc4c_heap_named(name);                     \
+__dc4c_heap_methods(name, type, comp)        \
+__dc4c_heap_cxx_wrapper(name, type)          \
+typedef struct heap_##name heap_##name##_t
+
+/**
+ * @brief Defines a heap containing the given type.
+ *
+ * @param type the contained type
+ * @param comp the comparison function, called with two pointers to the contained type
+ */
+#define typedef_heap(type, comp) typedef_heap_named(type, type, comp)
+
+/** The initial values for a heap. */
+#define heap_initializer { vector_initializer }
+
+/**
+ * Initializes the given heap.
+ *
+ * @param heapPtr the pointer to the heap
+ */
+#define heap_init(heapPtr) vector_init(&(heapPtr)->vector)
+
+/**
+ * Returns the amount of elements held by the given heap.
+ *
+ * @param heapPtr the pointer to the heap
+ * @return the amount of elements in the given heap
+ */
+#define heap_size(heapPtr) vector_size(&(heapPtr)->vector)
+
+/**
+ * Returns whether the given heap is empty.
+ *
+ * @param heapPtr the pointer to the heap
+ * @return whether the heap holds no elements
+ */
+#define heap_empty(heapPtr) ({ (heapPtr)->vector.count == 0; })
+
+/**
+ * Removes all content of the given heap.
+ *
+ * @param heapPtr the pointer to the heap
+ */
+#define heap_clear(heapPtr) vector_clear(&(heapPtr)->vector)
+
+/**
+ * @brief Destroys the given heap.
+ *
+ * The destroyed heap must be reconstructed before being used again.
+ *
+ * @param heapPtr the pointer to the heap
+ */
+#define heap_destroy(heapPtr) vector_destroy(&(heapPtr)->vector)
+
+/**
+ * Defines the indexed heap structure.
+ *
+ * @param name the name of the indexed heap
+ * @param type the contained type
+ */
+#define __dc4c_indexed_heap_named(name, type) \
+struct indexed_heap_##name {                  \
+    size_t count;                             \
+    size_t cap;                               \
+    struct {                                  \
+        type   key;                           \
+        size_t id;                            \
+    }*     content;                           \
+    size_t* positions;                        \
+}
+
+/**
+ * @brief Defines the functions of the indexed heap.
+ *
+ * @param name the name of the indexed heap
+ * @param type the contained type
+ * @param comp the comparison function
+ */
+#define __dc4c_indexed_heap_methods(name, type, comp)                                                          \
+static inline void __dc4c_indexed_heap_place_##name(struct indexed_heap_##name* self, size_t position,         \
+                                                    type key, size_t id) {                                     \
+    self->content[position].key = key;                                                                         \
+    self->content[position].id  = id;                                                                          \
+    self->positions[id]         = position;                                                                    \
+}                                                                                                              \
+                                                                                                               \
+static inline void __dc4c_indexed_heap_move_##name(struct indexed_heap_##name* self, size_t to, size_t from) { \
+    self->content[to] = self->content[from];                                                                   \
+    self->positions[self->content[to].id] = to;                                                                \
+}                                                                                                              \
+                                                                                                               \
+static inline void __dc4c_indexed_heap_sift_up_##name(struct indexed_heap_##name* self, size_t position,       \
+                                                      type key, size_t id) {                                   \
+    while (position > 0) {                                                                                     \
+        const size_t parent = (position - 1) / DC4C_HEAP_ARITY;                                                \
+        if (!(comp(&self->content[parent].key, &key) < 0)) {                                                   \
+            break;                                                                                             \
+        }                                                                                                      \
+        __dc4c_indexed_heap_move_##name(self, position, parent);                                               \
+        position = parent;                                                                                     \
+    }                                                                                                          \
+    __dc4c_indexed_heap_place_##name(self, position, key, id);                                                 \
+}                                                                                                              \
+                                                                                                               \
+static inline void __dc4c_indexed_heap_sift_down_##name(struct indexed_heap_##name* self, size_t position,     \
+                                                        type key, size_t id) {                                 \
+    for (;;) {                                                                                                 \
+        const size_t first = position * DC4C_HEAP_ARITY + 1;                                                   \
+        if (first >= self->count) {                                                                            \
+            break;                                                                                             \
+        }                                                                                                      \
+        const size_t last = self->count - first < DC4C_HEAP_ARITY ? self->count : first + DC4C_HEAP_ARITY;     \
+        size_t best = first;                                                                                   \
+        for (size_t child = first + 1; child < last; ++child) {                                                \
+            if (comp(&self->content[best].key, &self->content[child].key) < 0) {                               \
+                best = child;                                                                                  \
+            }                                                                                                  \
+        }                                                                                                      \
+        if (!(comp(&key, &self->content[best].key) < 0)) {                                                     \
+            break;                                                                                             \
+        }                                                                                                      \
+        __dc4c_indexed_heap_move_##name(self, position, best);                                                 \
+        position = best;                                                                                       \
+    }                                                                                                          \
+    __dc4c_indexed_heap_place_##name(self, position, key, id);                                                 \
+}                                                                                                              \
+                                                                                                               \
+static inline bool indexed_heap_reserve_##name(struct indexed_heap_##name* self, size_t ids) {                 \
+    if (self->cap >= ids) {                                                                                    \
+        return true;                                                                                           \
+    }                                                                                                          \
+    __DC4C_TYPEOF(self->content) content = (__DC4C_TYPEOF(self->content))                                      \
+        realloc(self->content, sizeof(*self->content) * ids);                                                  \
+    if (content == NULL) {                                                                                     \
+        return false;                                                                                          \
+    }                                                                                                          \
+    self->content = content;                                                                                   \
+    size_t* positions = (size_t*) realloc(self->positions, sizeof(*self->positions) * ids);                    \
+    if (positions == NULL) {                                                                                   \
+        return false;                                                                                          \
+    }                                                                                                          \
+    for (size_t i = self->cap; i < ids; ++i) {                                                                 \
+        positions[i] = SIZE_MAX;                                                                               \
+    }                                                                                                          \
+    self->positions = positions;                                                                               \
+    self->cap       = ids;                                                                                     \
+    return true;                                                                                               \
+}                                                                                                              \
+                                                                                                               \
+static inline bool indexed_heap_contains_##name(const struct indexed_heap_##name* self, size_t id) {           \
+    return id < self->cap && self->positions[id] != SIZE_MAX;                                                  \
+}                                                                                                              \
+                                                                                                               \
+static inline bool indexed_heap_push_##name(struct indexed_heap_##name* self, size_t id, type key) {           \
+    if (indexed_heap_contains_##name(self, id)) {                                                              \
+        return false;                                                                                          \
+    }                                                                                                          \
+    if (id >= self->cap                                                                                        \
+        && !indexed_heap_reserve_##name(self, id + 1 > self->cap * 2 ? id + 1 : self->cap * 2)) {              \
+        return false;                                                                                          \
+    }                                                                                                          \
+    __dc4c_indexed_heap_sift_up_##name(self, self->count++, key, id);                                          \
+    return true;                                                                                               \
+}                                                                                                              \
+                                                                                                               \
+static inline size_t indexed_heap_top_##name(const struct indexed_heap_##name* self) {                         \
+    return self->content[0].id;                                                                                \
+}                                                                                                              \
+                                                                                                               \
+static inline type indexed_heap_key_##name(const struct indexed_heap_##name* self, size_t id) {                \
+    return self->content[self->positions[id]].key;                                                             \
+}                                                                                                              \
+                                                                                                               \
+static inline void indexed_heap_update_##name(struct indexed_heap_##name* self, size_t id, type key) {         \
+    const size_t position = self->positions[id];                                                               \
+    if (comp(&self->content[position].key, &key) < 0) {                                                        \
+        __dc4c_indexed_heap_sift_up_##name(self, position, key, id);                                           \
+    } else {                                                                                                   \
+        __dc4c_indexed_heap_sift_down_##name(self, position, key, id);                                         \
+    }                                                                                                          \
+}                                                                                                              \
+                                                                                                               \
+static inline void indexed_heap_erase_##name(struct indexed_heap_##name* self, size_t id) {                    \
+    const size_t position = self->positions[id];                                                               \
+    self->positions[id] = SIZE_MAX;                                                                            \
+    if (position == --self->count) {                                                                           \
+        return;                                                                                                \
+    }                                                                                                          \
+    const size_t lastId  = self->content[self->count].id;                                                      \
+    type         lastKey = self->content[self->count].key;                                                     \
+    if (comp(&self->content[position].key, &lastKey) < 0) {                                                    \
+        __dc4c_indexed_heap_sift_up_##name(self, position, lastKey, lastId);                                   \
+    } else {                                                                                                   \
+        __dc4c_indexed_heap_sift_down_##name(self, position, lastKey, lastId);                                 \
+    }                                                                                                          \
+}                                                                                                              \
+                                                                                                               \
+static inline size_t indexed_heap_pop_##name(struct indexed_heap_##name* self) {                               \
+    const size_t toReturn = self->content[0].id;                                                               \
+    indexed_heap_erase_##name(self, toReturn);                                                                 \
+    return toReturn;                                                                                           \
+}
+
+/**
+ * @brief Defines an indexed heap of the given name containing the given type.
+ *
+ * Each element of an indexed heap consists of a key of the given type and an
+ * identifier in the range [0 ... n). The position of each identifier inside
+ * of the heap is tracked, so the key of an element can be updated in
+ * O(log n).<br>
+ * The following functions are defined:
+ * - @c indexed_heap_reserve_NAME(heap, ids) prepares the heap for the identifiers [0 ... ids)
+ * - @c indexed_heap_push_NAME(heap, id, key) adds an element and returns whether it was added, which is not the case
+ *   if the identifier is already in the heap or the allocation failed
+ * - @c indexed_heap_contains_NAME(heap, id) returns whether an element is in the heap
+ * - @c indexed_heap_top_NAME(heap) returns the identifier of the top element
+ * - @c indexed_heap_key_NAME(heap, id) returns the key of an element in the heap
+ * - @c indexed_heap_pop_NAME(heap) removes the top element and returns its identifier
+ * - @c indexed_heap_update_NAME(heap, id, key) changes the key of an element in the heap
+ * - @c indexed_heap_erase_NAME(heap, id) removes an element from the heap
+ *
+ * @param name the name of the indexed heap
+ * @param type the type of the keys
+ * @param comp the comparison function, called with two pointers to keys
+ */
+#define typedef_indexed_heap_named(name, type, comp) \
+__dc4c_indexed_heap_named(name, type);               \
+__dc4c_indexed_heap_methods(name, type, comp)        \
+typedef struct indexed_heap_##name indexed_heap_##name##_t
+
+/** The initial values for an indexed heap. */
+#define indexed_heap_initializer { 0, 0, NULL, NULL }
+
+/**
+ * Returns the amount of elements held by the given indexed heap.
+ *
+ * @param heapPtr the pointer to the indexed heap
+ * @return the amount of elements in the given indexed heap
+ */
+#define indexed_heap_size(heapPtr) ({ (heapPtr)->count; })
+
+/**
+ * @brief Destroys the given indexed heap.
+ *
+ * The destroyed indexed heap must be reconstructed before being used again.
+ *
+ * @param heapPtr the pointer to the indexed heap
+ */
+#define indexed_heap_destroy(heapPtr)             \
+do {                                              \
+    __DC4C_TYPEOF((heapPtr)) __h_ihd = (heapPtr); \
+                                                  \
+    free(__h_ihd->content);                       \
+    free(__h_ihd->positions);                     \
+} while (0)
+
+#ifdef __cplusplus
+# include "heap.hpp"
+#endif
+
+#ifndef __dc4c_heap_cxx_wrapper
+# define __dc4c_heap_cxx_wrapper(name, type)
+#endif
+
+#endif /* __DC4C_heap_h */
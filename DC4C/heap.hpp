@@ -0,0 +1,215 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_heap_h
+# warning Wrong inclusion of "heap.hpp" redirected to #include "heap.h"!
+# include "heap.h"
+#else
+# ifndef __DC4C_heap_hpp
+# define __DC4C_heap_hpp
+
+# include <new>
+# include <vector>
+
+namespace dc4c {
+/**
+ * The functions of a C heap, specialized by @c typedef_heap_named .
+ *
+ * @tparam T the C DC4C heap type
+ */
+template<typename T>
+struct heap_traits;
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for the C heap of DC4C.
+ *
+ * It offers the same interface as the @c std::priority_queue , the element
+ * comparing greatest is on top.
+ *
+ * @tparam T the C DC4C heap type to be managed by this wrapper class
+ */
+template<typename T>
+class heap {
+    /** The functions of the C heap. */
+    using traits = heap_traits<T>;
+
+    /** The underlying C heap. */
+    T underlying;
+
+public:
+    /** The type used for the size of the heap. */
+    using size_type = std::size_t;
+    /** The type stored in the underlying heap. */
+    using value_type = typename traits::value_type;
+
+    inline heap(): underlying(heap_initializer) {}
+
+    inline heap(const heap& other): underlying(heap_initializer) {
+        vector_copy(&underlying.vector, &other.underlying.vector);
+    }
+
+    inline heap(heap&& other) noexcept: underlying(other.underlying) {
+        heap_init(&other.underlying);
+    }
+
+    /**
+     * Constructs a heap from the given C++ @c std::vector in linear time.
+     *
+     * @param other the C++ standard vector to be copied
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline heap(const std::vector<value_type>& other): underlying(heap_initializer) {
+        auto vector = decltype(underlying.vector)(vector_initializer);
+        if (!vector_reserve(&vector, other.size())) {
+            throw std::bad_alloc();
+        }
+        for (const auto& element : other) {
+            vector_push_back(&vector, element);
+        }
+        traits::make(&underlying, &vector);
+    }
+
+    inline ~heap() {
+        heap_destroy(&underlying);
+    }
+
+    inline auto operator=(const heap& other) -> heap& {
+        heap_destroy(&underlying);
+        vector_copy(&underlying.vector, &other.underlying.vector);
+        return *this;
+    }
+
+    inline auto operator=(heap&& other) noexcept -> heap& {
+        heap_destroy(&underlying);
+        underlying = other.underlying;
+        heap_init(&other.underlying);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the underlying C heap.
+     *
+     * @return the underlying C heap
+     */
+    inline auto data() -> T& {
+        return underlying;
+    }
+
+    /**
+     * @brief Returns the underlying C heap.
+     *
+     * @return the underlying C heap
+     */
+    constexpr inline auto data() const -> const T& {
+        return underlying;
+    }
+
+    /**
+     * Returns the element on top of the heap, the heap must not be empty.
+     *
+     * @return the greatest element
+     */
+    inline auto top() const noexcept -> const value_type& {
+        return underlying.vector.content[0];
+    }
+
+    /**
+     * Adds the given value to the heap.
+     *
+     * @param value the value to be added
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void push(const value_type& value) {
+        if (!traits::push(&underlying, value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Removes the element on top of the heap, the heap must not be empty.
+     */
+    inline void pop() noexcept {
+        traits::pop(&underlying);
+    }
+
+    /**
+     * Replaces the element on top of the heap, which must not be empty.
+     *
+     * @param value the new value
+     * @return the replaced element
+     */
+    inline auto replace_top(const value_type& value) noexcept -> value_type {
+        return traits::replace_top(&underlying, value);
+    }
+
+    /**
+     * Returns whether this heap is empty.
+     *
+     * @return whether no elements are held
+     */
+    constexpr inline auto empty() const noexcept -> bool {
+        return underlying.vector.count == 0;
+    }
+
+    /**
+     * Returns the amount of elements held by this heap.
+     *
+     * @return the amount of held elements
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.vector.count;
+    }
+};
+}
+
+/**
+ * Defines the C++ wrapper of the heap of the given name.
+ *
+ * @param name the name of the C heap
+ * @param type the contained type
+ */
+# define __dc4c_heap_cxx_wrapper(name, type)                                         \
+namespace dc4c {                                                                     \
+template<>                                                                           \
+struct heap_traits<::heap_##name> {                                                  \
+    using value_type = type;                                                         \
+                                                                                     \
+    static inline auto push(::heap_##name* self, const type& value) -> bool {        \
+        return heap_push_##name(self, value);                                        \
+    }                                                                                \
+                                                                                     \
+    static inline auto pop(::heap_##name* self) -> type {                            \
+        return heap_pop_##name(self);                                                \
+    }                                                                                \
+                                                                                     \
+    static inline auto replace_top(::heap_##name* self, const type& value) -> type { \
+        return heap_replace_top_##name(self, value);                                 \
+    }                                                                                \
+                                                                                     \
+    static inline void make(::heap_##name* self, ::vector_##name* vector) {          \
+        heap_make_##name(self, vector);                                              \
+    }                                                                                \
+};                                                                                   \
+}                                                                                    \
+namespace dc4c {                                                                     \
+using heap_##name = heap<::heap_##name>;                                             \
+}
+
+# endif /* __DC4C_heap_hpp */
+#endif /* !__DC4C_heap_h */
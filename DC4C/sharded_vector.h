@@ -0,0 +1,346 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_sharded_vector_h
+#define __DC4C_sharded_vector_h
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "vector.h"
+
+/** The assumed size of a cache line. */
+#define __DC4C_SHARDED_VECTOR_CACHE_LINE 64
+
+/**
+ * The beginning of every job run by @c __dc4c_sharded_vector_run .
+ */
+struct __dc4c_sharded_vector_worker {
+    /** The thread running the job.          */
+    pthread_t thread;
+    /** Whether the thread has been created. */
+    bool      started;
+};
+
+/**
+ * @brief Runs the given jobs, each one in its own thread.
+ *
+ * Every job needs to begin with a @c __dc4c_sharded_vector_worker . The first
+ * job is run by the calling thread. If a thread cannot be created, its job is
+ * run by the calling thread as well.
+ *
+ * @param routine the function running one job
+ * @param jobs the jobs
+ * @param jobSize the size of one job in bytes
+ * @param jobCount the amount of jobs
+ */
+static inline void __dc4c_sharded_vector_run(void* (*routine)(void*), void* jobs, size_t jobSize, size_t jobCount) {
+    for (size_t i = 1; i < jobCount; ++i) {
+        struct __dc4c_sharded_vector_worker* worker = (struct __dc4c_sharded_vector_worker*) ((char*) jobs + i * jobSize);
+        worker->started = pthread_create(&worker->thread, NULL, routine, worker) == 0;
+    }
+    routine(jobs);
+    for (size_t i = 1; i < jobCount; ++i) {
+        struct __dc4c_sharded_vector_worker* worker = (struct __dc4c_sharded_vector_worker*) ((char*) jobs + i * jobSize);
+        if (worker->started) {
+            pthread_join(worker->thread, NULL);
+        } else {
+            routine(worker);
+        }
+    }
+}
+
+/**
+ * Defines the structures of the sharded vector.
+ *
+ * @param name the name of the sharded vector
+ * @param type the contained type
+ */
+#define __dc4c_sharded_vector_named(name, type)               \
+struct sharded_vector_shard_##name {                          \
+    struct vector_##name vector;                              \
+} __attribute__((aligned(__DC4C_SHARDED_VECTOR_CACHE_LINE))); \
+                                                              \
+struct sharded_vector_##name {                                \
+    size_t                              count;                \
+    void*                               block;                \
+    struct sharded_vector_shard_##name* shards;               \
+};                                                            \
+                                                              \
+struct sharded_vector_job_##name {                            \
+    struct __dc4c_sharded_vector_worker worker;               \
+    struct sharded_vector_shard_##name* shards;               \
+    const size_t*                       bounds;               \
+    size_t                              runs;                 \
+    size_t                              first;                \
+    size_t                              step;                 \
+    size_t                              last;                 \
+    const type*                         source;               \
+    type*                               destination;          \
+    int (*comp)(const type*, const type*);                    \
+}
+
+/**
+ * Defines the functions of the sharded vector.
+ *
+ * @param name the name of the sharded vector
+ * @param type the contained type
+ */
+#define __dc4c_sharded_vector_methods(name, type)                                                                          \
+static inline bool sharded_vector_init_##name(struct sharded_vector_##name* self, size_t count) {                          \
+    self->count  = 0;                                                                                                      \
+    self->block  = NULL;                                                                                                   \
+    self->shards = NULL;                                                                                                   \
+    if (count == 0) return true;                                                                                           \
+    if (count > (SIZE_MAX - __DC4C_SHARDED_VECTOR_CACHE_LINE) / sizeof(struct sharded_vector_shard_##name)) {              \
+        return false;                                                                                                      \
+    }                                                                                                                      \
+                                                                                                                           \
+    self->block = malloc(count * sizeof(struct sharded_vector_shard_##name) + __DC4C_SHARDED_VECTOR_CACHE_LINE - 1);       \
+    if (self->block == NULL) return false;                                                                                 \
+                                                                                                                           \
+    self->shards = (struct sharded_vector_shard_##name*) (((uintptr_t) self->block + __DC4C_SHARDED_VECTOR_CACHE_LINE - 1) \
+                                                          & ~(uintptr_t) (__DC4C_SHARDED_VECTOR_CACHE_LINE - 1));          \
+    for (size_t i = 0; i < count; ++i) {                                                                                   \
+        vector_init(&self->shards[i].vector);                                                                              \
+    }                                                                                                                      \
+    self->count = count;                                                                                                   \
+    return true;                                                                                                           \
+}                                                                                                                          \
+                                                                                                                           \
+static inline void sharded_vector_destroy_##name(struct sharded_vector_##name* self) {                                     \
+    for (size_t i = 0; i < self->count; ++i) {                                                                             \
+        vector_destroy(&self->shards[i].vector);                                                                           \
+    }                                                                                                                      \
+    free(self->block);                                                                                                     \
+}                                                                                                                          \
+                                                                                                                           \
+static inline void* __dc4c_sharded_vector_copy_##name(void* argument) {                                                    \
+    struct sharded_vector_job_##name* job = (struct sharded_vector_job_##name*) argument;                                  \
+                                                                                                                           \
+    for (size_t i = job->first; i < job->last; i += job->step) {                                                           \
+        struct vector_##name* shard = &job->shards[i].vector;                                                              \
+        if (shard->count == 0) continue;                                                                                   \
+                                                                                                                           \
+        if (job->comp != NULL) {                                                                                           \
+            qsort(shard->content, shard->count, sizeof(type), (int (*)(const void*, const void*)) job->comp);              \
+        }                                                                                                                  \
+        memcpy(job->destination + job->bounds[i], shard->content, shard->count * sizeof(type));                            \
+    }                                                                                                                      \
+    return NULL;                                                                                                           \
+}                                                                                                                          \
+                                                                                                                           \
+static inline void* __dc4c_sharded_vector_merge_##name(void* argument) {                                                   \
+    struct sharded_vector_job_##name* job = (struct sharded_vector_job_##name*) argument;                                  \
+                                                                                                                           \
+    for (size_t i = job->first; i < job->last; i += job->step) {                                                           \
+        const type* lhs    = job->source + job->bounds[2 * i];                                                             \
+        const type* lhsEnd = job->source + job->bounds[2 * i + 1 < job->runs ? 2 * i + 1 : job->runs];                     \
+        const type* rhs    = lhsEnd;                                                                                       \
+        const type* rhsEnd = job->source + job->bounds[2 * i + 2 < job->runs ? 2 * i + 2 : job->runs];                     \
+        type*       out    = job->destination + job->bounds[2 * i];                                                        \
+        while (lhs < lhsEnd && rhs < rhsEnd) {                                                                             \
+            *out++ = job->comp(rhs, lhs) < 0 ? *rhs++ : *lhs++;                                                            \
+        }                                                                                                                  \
+        memcpy(out, lhs, (size_t) (lhsEnd - lhs) * sizeof(type));                                                          \
+        out += lhsEnd - lhs;                                                                                               \
+        memcpy(out, rhs, (size_t) (rhsEnd - rhs) * sizeof(type));                                                          \
+    }                                                                                                                      \
+    return NULL;                                                                                                           \
+}                                                                                                                          \
+                                                                                                                           \
+static inline bool __dc4c_sharded_vector_gather_##name(struct sharded_vector_##name* self,                                 \
+                                                       struct vector_##name*         target,                               \
+                                                       size_t                        threads,                              \
+                                                       int (*comp)(const type*, const type*)) {                            \
+    size_t total = 0, runs = 0;                                                                                            \
+    for (size_t i = 0; i < self->count; ++i) {                                                                             \
+        total += self->shards[i].vector.count;                                                                             \
+        runs  += self->shards[i].vector.count > 0;                                                                         \
+    }                                                                                                                      \
+    if (total == 0) return true;                                                                                           \
+                                                                                                                           \
+    size_t rounds = 0;                                                                                                     \
+    if (comp != NULL) {                                                                                                    \
+        for (size_t remaining = runs; remaining > 1; remaining = (remaining + 1) / 2) ++rounds;                            \
+    }                                                                                                                      \
+    const size_t workers = threads == 0 ? 1 : threads < self->count ? threads : self->count;                               \
+    size_t* bounds = (size_t*) malloc((self->count + 1) * sizeof(size_t));                                                 \
+    struct sharded_vector_job_##name* jobs = (struct sharded_vector_job_##name*)                                           \
+        malloc(workers * sizeof(struct sharded_vector_job_##name));                                                        \
+    type* buffer = rounds == 0 ? NULL : (type*) malloc(total * sizeof(type));                                              \
+    if (bounds == NULL || jobs == NULL || (rounds > 0 && buffer == NULL)                                                   \
+        || !vector_reserve(target, target->count + total)) {                                                               \
+        free(bounds);                                                                                                      \
+        free(jobs);                                                                                                        \
+        free(buffer);                                                                                                      \
+        return false;                                                                                                      \
+    }                                                                                                                      \
+                                                                                                                           \
+    bounds[0] = 0;                                                                                                         \
+    for (size_t i = 0; i < self->count; ++i) {                                                                             \
+        bounds[i + 1] = bounds[i] + self->shards[i].vector.count;                                                          \
+    }                                                                                                                      \
+    type* destination = rounds % 2 == 0 ? target->content + target->count : buffer;                                        \
+    type* other       = rounds % 2 == 0 ? buffer : target->content + target->count;                                        \
+    for (size_t i = 0; i < workers; ++i) {                                                                                 \
+        jobs[i].shards      = self->shards;                                                                                \
+        jobs[i].bounds      = bounds;                                                                                      \
+        jobs[i].runs        = 0;                                                                                           \
+        jobs[i].first       = i;                                                                                           \
+        jobs[i].step        = workers;                                                                                     \
+        jobs[i].last        = self->count;                                                                                 \
+        jobs[i].source      = NULL;                                                                                        \
+        jobs[i].destination = destination;                                                                                 \
+        jobs[i].comp        = comp;                                                                                        \
+    }                                                                                                                      \
+    __dc4c_sharded_vector_run(__dc4c_sharded_vector_copy_##name, jobs, sizeof(*jobs), workers);                            \
+                                                                                                                           \
+    if (rounds > 0) {                                                                                                      \
+        size_t run = 0;                                                                                                    \
+        for (size_t i = 0; i < self->count; ++i) {                                                                         \
+            if (bounds[i + 1] > bounds[i]) {                                                                               \
+                bounds[run++] = bounds[i];                                                                                 \
+            }                                                                                                              \
+        }                                                                                                                  \
+        bounds[run] = total;                                                                                               \
+                                                                                                                           \
+        for (; runs > 1; runs = (runs + 1) / 2) {                                                                          \
+            const size_t pairs  = (runs + 1) / 2;                                                                          \
+            const size_t active = workers < pairs ? workers : pairs;                                                       \
+            for (size_t i = 0; i < active; ++i) {                                                                          \
+                jobs[i].runs        = runs;                                                                                \
+                jobs[i].step        = active;                                                                              \
+                jobs[i].last        = pairs;                                                                               \
+                jobs[i].source      = destination;                                                                         \
+                jobs[i].destination = other;                                                                               \
+            }                                                                                                              \
+            __dc4c_sharded_vector_run(__dc4c_sharded_vector_merge_##name, jobs, sizeof(*jobs), active);                    \
+                                                                                                                           \
+            for (size_t i = 1; i < pairs; ++i) {                                                                           \
+                bounds[i] = bounds[2 * i];                                                                                 \
+            }                                                                                                              \
+            bounds[pairs] = total;                                                                                         \
+            type* swap  = destination;                                                                                     \
+            destination = other;                                                                                           \
+            other       = swap;                                                                                            \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    for (size_t i = 0; i < self->count; ++i) {                                                                             \
+        vector_clear(&self->shards[i].vector);                                                                             \
+    }                                                                                                                      \
+    __dc4c_vector_stats_copy(target, total * sizeof(type));                                                                \
+    target->count += total;                                                                                                \
+    free(bounds);                                                                                                          \
+    free(jobs);                                                                                                            \
+    free(buffer);                                                                                                          \
+    return true;                                                                                                           \
+}                                                                                                                          \
+                                                                                                                           \
+static inline bool sharded_vector_gather_##name(struct sharded_vector_##name* self,                                        \
+                                                struct vector_##name*         target,                                      \
+                                                size_t                        threads) {                                   \
+    return __dc4c_sharded_vector_gather_##name(self, target, threads, NULL);                                               \
+}                                                                                                                          \
+                                                                                                                           \
+static inline bool sharded_vector_gather_sorted_##name(struct sharded_vector_##name* self,                                 \
+                                                       struct vector_##name*         target,                               \
+                                                       size_t                        threads,                              \
+                                                       int (*comp)(const type*, const type*)) {                            \
+    return __dc4c_sharded_vector_gather_##name(self, target, threads, comp);                                               \
+}
+
+/**
+ * @brief Defines a sharded vector of the given name containing the given type.
+ *
+ * A sharded vector collects elements from multiple threads: each thread
+ * appends to its own shard, which is a vector of the same name aligned to its
+ * own cache line. The shards are gathered into one vector using a single
+ * allocation, the offsets of the shards are the prefix sums of their sizes,
+ * so the shards are copied in parallel. A sorted gather sorts the shards in
+ * parallel and merges them pairwise in parallel rounds. The vector of the
+ * same name needs to be defined before.<br>
+ * The following functions are defined:
+ * - @c sharded_vector_init_NAME(sharded, shards) initializes the given amount of empty shards, returns whether it succeeded
+ * - @c sharded_vector_destroy_NAME(sharded) destroys the sharded vector and its shards
+ * - @c sharded_vector_gather_NAME(sharded, vector, threads) appends all shards to the vector, returns whether it succeeded
+ * - @c sharded_vector_gather_sorted_NAME(sharded, vector, threads, comp) appends the sorted content of all shards
+ *
+ * Gathering empties the shards, keeping their memory. If the allocation
+ * failed, the shards and the vector are left unchanged. No shard may be
+ * modified during a gather.
+ *
+ * @param name the name of the sharded vector and of its vector
+ * @param type the contained type
+ */
+#define typedef_sharded_vector_named(name, type) \
+__dc4c_sharded_vector_named(name, type);         \
+__dc4c_sharded_vector_methods(name, type)        \
+__dc4c_sharded_vector_cxx_wrapper(name, type)    \
+typedef struct sharded_vector_##name sharded_vector_##name##_t
+
+/**
+ * @brief Defines a sharded vector containing the given type.
+ *
+ * @param type the contained type
+ */
+#define typedef_sharded_vector(type) typedef_sharded_vector_named(type, type)
+
+/**
+ * @brief Returns the shard of the given index.
+ *
+ * Only one thread may modify a shard at a time, different shards can be
+ * modified concurrently.
+ *
+ * @param shardedPtr the pointer to the sharded vector
+ * @param index the index of the shard
+ * @return the pointer to the vector of the shard
+ */
+#define sharded_vector_shard(shardedPtr, index) (&(shardedPtr)->shards[(index)].vector)
+
+/**
+ * Returns the amount of shards of the given sharded vector.
+ *
+ * @param shardedPtr the pointer to the sharded vector
+ * @return the amount of shards
+ */
+#define sharded_vector_shards(shardedPtr) ({ (shardedPtr)->count; })
+
+/**
+ * Returns the amount of elements stored in all shards of the given sharded vector.
+ *
+ * @param shardedPtr the pointer to the sharded vector
+ * @return the amount of stored elements
+ */
+#define sharded_vector_size(shardedPtr) ({                             \
+    __DC4C_TYPEOF((shardedPtr)) __s_svs = (shardedPtr);                \
+                                                                       \
+    size_t __svs_result = 0;                                           \
+    for (size_t __dc4c_i = 0; __dc4c_i < __s_svs->count; ++__dc4c_i) { \
+        __svs_result += __s_svs->shards[__dc4c_i].vector.count;        \
+    }                                                                  \
+    __svs_result;                                                      \
+})
+
+#ifdef __cplusplus
+# include "sharded_vector.hpp"
+#endif
+
+#ifndef __dc4c_sharded_vector_cxx_wrapper
+# define __dc4c_sharded_vector_cxx_wrapper(name, type)
+#endif
+
+#endif /* __DC4C_sharded_vector_h */
@@ -0,0 +1,207 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_sharded_vector_h
+# warning Wrong inclusion of "sharded_vector.hpp" redirected to #include "sharded_vector.h"!
+# include "sharded_vector.h"
+#else
+# ifndef __DC4C_sharded_vector_hpp
+# define __DC4C_sharded_vector_hpp
+
+# include <new>
+
+namespace dc4c {
+/**
+ * The functions of a C sharded vector, specialized by @c typedef_sharded_vector_named .
+ *
+ * @tparam T the C DC4C sharded vector type
+ */
+template<typename T>
+struct sharded_vector_traits;
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for the C sharded vector of DC4C.
+ *
+ * Each thread appends to its own shard, the shards are gathered into one
+ * vector afterwards.
+ *
+ * @tparam T the C DC4C sharded vector type to be managed by this wrapper class
+ */
+template<typename T>
+class sharded_vector {
+    /** The functions of the C sharded vector. */
+    using traits = sharded_vector_traits<T>;
+
+    /** The underlying C sharded vector. */
+    T underlying;
+
+public:
+    /** The type used for the size of the sharded vector. */
+    using size_type = std::size_t;
+    /** The type stored in the shards.                     */
+    using value_type = typename traits::value_type;
+    /** The C vector type of the shards.                   */
+    using vector_type = typename traits::vector_type;
+    /** The type of the comparison functions.              */
+    using comparator = int (*)(const value_type*, const value_type*);
+
+    /**
+     * Constructs a sharded vector with the given amount of shards.
+     *
+     * @param shards the amount of shards
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline explicit sharded_vector(size_type shards) {
+        if (!traits::init(&underlying, shards)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    sharded_vector(const sharded_vector&) = delete;
+
+    inline ~sharded_vector() {
+        traits::destroy(&underlying);
+    }
+
+    auto operator=(const sharded_vector&) -> sharded_vector& = delete;
+
+    /**
+     * @brief Returns the underlying C sharded vector.
+     *
+     * @return the underlying C sharded vector
+     */
+    __DC4C_CONSTEXPR_SINCE_CXX14 inline auto data() noexcept -> T& {
+        return underlying;
+    }
+
+    /**
+     * @brief Returns the shard of the given index.
+     *
+     * The index is not range checked.
+     *
+     * @param index the index of the shard
+     * @return the C vector of the shard
+     */
+    inline auto shard(size_type index) noexcept -> vector_type& {
+        return *sharded_vector_shard(&underlying, index);
+    }
+
+    /**
+     * @brief Adds the given value at the end of the shard of the given index.
+     *
+     * Different shards can be appended to concurrently.
+     *
+     * @param index the index of the shard
+     * @param value the value to be added
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void push_back(size_type index, const value_type& value) {
+        if (!vector_push_back(sharded_vector_shard(&underlying, index), value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Moves the content of all shards into a new vector.
+     *
+     * @param threads the amount of threads copying the shards
+     * @return the vector holding the content of all shards
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline auto gather(size_type threads = 1) -> vector<vector_type> {
+        auto toReturn = vector<vector_type>();
+        if (!traits::gather(&underlying, &toReturn.data(), threads)) {
+            throw std::bad_alloc();
+        }
+        return toReturn;
+    }
+
+    /**
+     * Moves the content of all shards sorted into a new vector.
+     *
+     * @param threads the amount of threads sorting and merging the shards
+     * @param comp the comparison function
+     * @return the vector holding the sorted content of all shards
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline auto gather_sorted(size_type threads, comparator comp) -> vector<vector_type> {
+        auto toReturn = vector<vector_type>();
+        if (!traits::gather_sorted(&underlying, &toReturn.data(), threads, comp)) {
+            throw std::bad_alloc();
+        }
+        return toReturn;
+    }
+
+    /**
+     * Returns the amount of shards.
+     *
+     * @return the amount of shards
+     */
+    constexpr inline auto shards() const noexcept -> size_type {
+        return underlying.count;
+    }
+
+    /**
+     * Returns the amount of elements stored in all shards.
+     *
+     * @return the amount of stored elements
+     */
+    inline auto size() const noexcept -> size_type {
+        return sharded_vector_size(&underlying);
+    }
+};
+}
+
+/**
+ * Defines the C++ wrapper of the sharded vector of the given name.
+ *
+ * @param name the name of the C sharded vector
+ * @param type the contained type
+ */
+# define __dc4c_sharded_vector_cxx_wrapper(name, type)                                                           \
+namespace dc4c {                                                                                                 \
+template<>                                                                                                       \
+struct sharded_vector_traits<::sharded_vector_##name> {                                                          \
+    using value_type  = type;                                                                                    \
+    using vector_type = ::vector_##name;                                                                         \
+                                                                                                                 \
+    static inline auto init(::sharded_vector_##name* self, std::size_t shards) -> bool {                         \
+        return sharded_vector_init_##name(self, shards);                                                         \
+    }                                                                                                            \
+                                                                                                                 \
+    static inline void destroy(::sharded_vector_##name* self) {                                                  \
+        sharded_vector_destroy_##name(self);                                                                     \
+    }                                                                                                            \
+                                                                                                                 \
+    static inline auto gather(::sharded_vector_##name* self, vector_type* target, std::size_t threads) -> bool { \
+        return sharded_vector_gather_##name(self, target, threads);                                              \
+    }                                                                                                            \
+                                                                                                                 \
+    static inline auto gather_sorted(::sharded_vector_##name* self, vector_type* target, std::size_t threads,    \
+                                     int (*comp)(const value_type*, const value_type*)) -> bool {                \
+        return sharded_vector_gather_sorted_##name(self, target, threads, comp);                                 \
+    }                                                                                                            \
+};                                                                                                               \
+}                                                                                                                \
+namespace dc4c {                                                                                                 \
+using sharded_vector_##name = sharded_vector<::sharded_vector_##name>;                                           \
+}
+
+# endif /* __DC4C_sharded_vector_hpp */
+#endif /* !__DC4C_sharded_vector_h */
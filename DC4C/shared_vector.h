@@ -0,0 +1,544 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_shared_vector_h
+#define __DC4C_shared_vector_h
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "vector.h"
+
+/**
+ * The amount of elements per chunk of the shared vectors. Can be defined
+ * before including this header.
+ */
+#ifndef DC4C_SHARED_VECTOR_CHUNK_SIZE
+# define DC4C_SHARED_VECTOR_CHUNK_SIZE 128
+#endif
+
+/** The assumed size of a cache line. */
+#define __DC4C_SHARED_VECTOR_CACHE_LINE 64
+
+/**
+ * A counter of readers, padded to its own cache line.
+ */
+struct __dc4c_shared_vector_counter {
+    /** The amount of readers.                                 */
+    size_t count;
+    /** Padding keeping other counters off of the cache line. */
+    char   padding[__DC4C_SHARED_VECTOR_CACHE_LINE - sizeof(size_t)];
+};
+
+/**
+ * @brief The synchronization state of a shared vector.
+ *
+ * Readers register in the counter of the current epoch. To wait for all
+ * readers that might still see an old snapshot, the writer flips the epoch
+ * twice, each time waiting for the counter of the previous epoch to drain.
+ */
+struct __dc4c_shared_vector_rcu {
+    /** The counters of the readers of both epochs. */
+    struct __dc4c_shared_vector_counter readers[2];
+    /** The current epoch.                          */
+    unsigned                            epoch;
+    /** The mutex serializing the writers.          */
+    pthread_mutex_t                     writer;
+};
+
+/**
+ * Initializes the given synchronization state.
+ *
+ * @param rcu the synchronization state
+ */
+static inline void __dc4c_shared_vector_rcu_init(struct __dc4c_shared_vector_rcu* rcu) {
+    rcu->readers[0].count = 0;
+    rcu->readers[1].count = 0;
+    rcu->epoch            = 0;
+    pthread_mutex_init(&rcu->writer, NULL);
+}
+
+/**
+ * Destroys the given synchronization state.
+ *
+ * @param rcu the synchronization state
+ */
+static inline void __dc4c_shared_vector_rcu_destroy(struct __dc4c_shared_vector_rcu* rcu) {
+    pthread_mutex_destroy(&rcu->writer);
+}
+
+/**
+ * @brief Enters a read-side critical section.
+ *
+ * Wait-free: the reader only registers in the counter of the current epoch.
+ *
+ * @param rcu the synchronization state
+ * @return the token to be passed to @c __dc4c_shared_vector_read_unlock
+ */
+static inline unsigned __dc4c_shared_vector_read_lock(struct __dc4c_shared_vector_rcu* rcu) {
+    const unsigned toReturn = __atomic_load_n(&rcu->epoch, __ATOMIC_SEQ_CST);
+    __atomic_fetch_add(&rcu->readers[toReturn].count, 1, __ATOMIC_SEQ_CST);
+    return toReturn;
+}
+
+/**
+ * Leaves a read-side critical section.
+ *
+ * @param rcu the synchronization state
+ * @param token the token returned by @c __dc4c_shared_vector_read_lock
+ */
+static inline void __dc4c_shared_vector_read_unlock(struct __dc4c_shared_vector_rcu* rcu, unsigned token) {
+    __atomic_fetch_sub(&rcu->readers[token].count, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Waits until all readers that entered before have left.
+ *
+ * Must be called by the writer holding the writer mutex.
+ *
+ * @param rcu the synchronization state
+ */
+static inline void __dc4c_shared_vector_synchronize(struct __dc4c_shared_vector_rcu* rcu) {
+    for (int phase = 0; phase < 2; ++phase) {
+        const unsigned epoch = __atomic_load_n(&rcu->epoch, __ATOMIC_RELAXED);
+        __atomic_store_n(&rcu->epoch, epoch ^ 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&rcu->readers[epoch].count, __ATOMIC_SEQ_CST) != 0) {
+            sched_yield();
+        }
+    }
+}
+
+/**
+ * Defines the structures of the shared vector.
+ *
+ * @param name the name of the shared vector
+ * @param type the contained type
+ */
+#define __dc4c_shared_vector_named(name, type)      \
+struct shared_vector_chunk_##name {                 \
+    size_t refs;                                    \
+    type   content[DC4C_SHARED_VECTOR_CHUNK_SIZE];  \
+};                                                  \
+                                                    \
+struct shared_vector_snapshot_##name {              \
+    size_t                              refs;       \
+    size_t                              count;      \
+    size_t                              chunkCount; \
+    size_t                              chunkCap;   \
+    struct shared_vector_chunk_##name** chunks;     \
+};                                                  \
+                                                    \
+struct shared_vector_##name {                       \
+    struct shared_vector_snapshot_##name* current;  \
+    struct __dc4c_shared_vector_rcu       rcu;      \
+}
+
+/**
+ * @brief Defines the functions of the shared vector.
+ *
+ * Snapshots and their chunks are reference counted. A draft starts sharing
+ * all chunks of the current snapshot, a chunk is copied when it is modified
+ * while still being shared.
+ *
+ * @param name the name of the shared vector
+ * @param type the contained type
+ */
+#define __dc4c_shared_vector_methods(name, type)                                                                      \
+static inline void __dc4c_shared_vector_chunk_release_##name(struct shared_vector_chunk_##name* chunk) {              \
+    if (__atomic_sub_fetch(&chunk->refs, 1, __ATOMIC_ACQ_REL) == 0) {                                                 \
+        free(chunk);                                                                                                  \
+    }                                                                                                                 \
+}                                                                                                                     \
+                                                                                                                      \
+static inline struct shared_vector_snapshot_##name* __dc4c_shared_vector_snapshot_new_##name(size_t chunkCap) {       \
+    struct shared_vector_snapshot_##name* toReturn = (struct shared_vector_snapshot_##name*)                          \
+        malloc(sizeof(struct shared_vector_snapshot_##name));                                                         \
+    if (toReturn == NULL) {                                                                                           \
+        return NULL;                                                                                                  \
+    }                                                                                                                 \
+    toReturn->refs       = 1;                                                                                         \
+    toReturn->count      = 0;                                                                                         \
+    toReturn->chunkCount = 0;                                                                                         \
+    toReturn->chunkCap   = chunkCap;                                                                                  \
+    toReturn->chunks     = NULL;                                                                                      \
+    if (chunkCap > 0) {                                                                                               \
+        toReturn->chunks = (struct shared_vector_chunk_##name**) malloc(chunkCap * sizeof(*toReturn->chunks));        \
+        if (toReturn->chunks == NULL) {                                                                               \
+            free(toReturn);                                                                                           \
+            return NULL;                                                                                              \
+        }                                                                                                             \
+    }                                                                                                                 \
+    return toReturn;                                                                                                  \
+}                                                                                                                     \
+                                                                                                                      \
+static inline bool __dc4c_shared_vector_reserve_##name(struct shared_vector_snapshot_##name* self,                    \
+                                                       size_t chunkCap) {                                             \
+    if (self->chunkCap >= chunkCap) {                                                                                 \
+        return true;                                                                                                  \
+    }                                                                                                                 \
+    struct shared_vector_chunk_##name** tmp = (struct shared_vector_chunk_##name**)                                   \
+        realloc(self->chunks, chunkCap * sizeof(*self->chunks));                                                      \
+    if (tmp == NULL) {                                                                                                \
+        return false;                                                                                                 \
+    }                                                                                                                 \
+    self->chunks   = tmp;                                                                                             \
+    self->chunkCap = chunkCap;                                                                                        \
+    return true;                                                                                                      \
+}                                                                                                                     \
+                                                                                                                      \
+static inline bool __dc4c_shared_vector_own_##name(struct shared_vector_snapshot_##name* self, size_t index) {        \
+    struct shared_vector_chunk_##name* chunk = self->chunks[index];                                                   \
+    if (__atomic_load_n(&chunk->refs, __ATOMIC_ACQUIRE) == 1) {                                                       \
+        return true;                                                                                                  \
+    }                                                                                                                 \
+    struct shared_vector_chunk_##name* copy = (struct shared_vector_chunk_##name*)                                    \
+        malloc(sizeof(struct shared_vector_chunk_##name));                                                            \
+    if (copy == NULL) {                                                                                               \
+        return false;                                                                                                 \
+    }                                                                                                                 \
+    copy->refs = 1;                                                                                                   \
+    memcpy(copy->content, chunk->content, sizeof(chunk->content));                                                    \
+    __dc4c_shared_vector_chunk_release_##name(chunk);                                                                 \
+    self->chunks[index] = copy;                                                                                       \
+    return true;                                                                                                      \
+}                                                                                                                     \
+                                                                                                                      \
+static inline void __dc4c_shared_vector_truncate_##name(struct shared_vector_snapshot_##name* self,                   \
+                                                        size_t count) {                                               \
+    const size_t chunkCount = (count + DC4C_SHARED_VECTOR_CHUNK_SIZE - 1) / DC4C_SHARED_VECTOR_CHUNK_SIZE;            \
+    while (self->chunkCount > chunkCount) {                                                                           \
+        __dc4c_shared_vector_chunk_release_##name(self->chunks[--self->chunkCount]);                                  \
+    }                                                                                                                 \
+    self->count = count;                                                                                              \
+}                                                                                                                     \
+                                                                                                                      \
+static inline void shared_vector_release_##name(struct shared_vector_snapshot_##name* self) {                         \
+    if (__atomic_sub_fetch(&self->refs, 1, __ATOMIC_ACQ_REL) != 0) {                                                  \
+        return;                                                                                                       \
+    }                                                                                                                 \
+    for (size_t i = 0; i < self->chunkCount; ++i) {                                                                   \
+        __dc4c_shared_vector_chunk_release_##name(self->chunks[i]);                                                   \
+    }                                                                                                                 \
+    free(self->chunks);                                                                                               \
+    free(self);                                                                                                       \
+}                                                                                                                     \
+                                                                                                                      \
+static inline bool shared_vector_init_##name(struct shared_vector_##name* self) {                                     \
+    self->current = __dc4c_shared_vector_snapshot_new_##name(0);                                                      \
+    if (self->current == NULL) {                                                                                      \
+        return false;                                                                                                 \
+    }                                                                                                                 \
+    __dc4c_shared_vector_rcu_init(&self->rcu);                                                                        \
+    return true;                                                                                                      \
+}                                                                                                                     \
+                                                                                                                      \
+static inline void shared_vector_destroy_##name(struct shared_vector_##name* self) {                                  \
+    shared_vector_release_##name(self->current);                                                                      \
+    __dc4c_shared_vector_rcu_destroy(&self->rcu);                                                                     \
+}                                                                                                                     \
+                                                                                                                      \
+static inline struct shared_vector_snapshot_##name* shared_vector_acquire_##name(struct shared_vector_##name* self) { \
+    const unsigned epoch = __dc4c_shared_vector_read_lock(&self->rcu);                                                \
+    struct shared_vector_snapshot_##name* toReturn = __atomic_load_n(&self->current, __ATOMIC_SEQ_CST);               \
+    __atomic_fetch_add(&toReturn->refs, 1, __ATOMIC_RELAXED);                                                         \
+    __dc4c_shared_vector_read_unlock(&self->rcu, epoch);                                                              \
+    return toReturn;                                                                                                  \
+}                                                                                                                     \
+                                                                                                                      \
+static inline struct shared_vector_snapshot_##name* shared_vector_edit_##name(struct shared_vector_##name* self) {    \
+    pthread_mutex_lock(&self->rcu.writer);                                                                            \
+    const struct shared_vector_snapshot_##name* current = self->current;                                              \
+    struct shared_vector_snapshot_##name* toReturn =                                                                  \
+        __dc4c_shared_vector_snapshot_new_##name(current->chunkCount);                                                \
+    if (toReturn == NULL) {                                                                                           \
+        pthread_mutex_unlock(&self->rcu.writer);                                                                      \
+        return NULL;                                                                                                  \
+    }                                                                                                                 \
+    for (size_t i = 0; i < current->chunkCount; ++i) {                                                                \
+        __atomic_fetch_add(&current->chunks[i]->refs, 1, __ATOMIC_RELAXED);                                           \
+        toReturn->chunks[i] = current->chunks[i];                                                                     \
+    }                                                                                                                 \
+    toReturn->count      = current->count;                                                                            \
+    toReturn->chunkCount = current->chunkCount;                                                                       \
+    return toReturn;                                                                                                  \
+}                                                                                                                     \
+                                                                                                                      \
+static inline bool shared_vector_set_##name(struct shared_vector_snapshot_##name* self,                               \
+                                            size_t position,                                                          \
+                                            type value) {                                                             \
+    const size_t index = position / DC4C_SHARED_VECTOR_CHUNK_SIZE;                                                    \
+    if (!__dc4c_shared_vector_own_##name(self, index)) {                                                              \
+        return false;                                                                                                 \
+    }                                                                                                                 \
+    self->chunks[index]->content[position % DC4C_SHARED_VECTOR_CHUNK_SIZE] = value;                                   \
+    return true;                                                                                                      \
+}                                                                                                                     \
+                                                                                                                      \
+static inline bool shared_vector_push_back_##name(struct shared_vector_snapshot_##name* self, type value) {           \
+    const size_t index = self->count / DC4C_SHARED_VECTOR_CHUNK_SIZE;                                                 \
+    if (index == self->chunkCount) {                                                                                  \
+        if (!__dc4c_shared_vector_reserve_##name(self, self->chunkCap == 0 ? 1 : self->chunkCap * 2)) {               \
+            return false;                                                                                             \
+        }                                                                                                             \
+        struct shared_vector_chunk_##name* chunk = (struct shared_vector_chunk_##name*)                               \
+            malloc(sizeof(struct shared_vector_chunk_##name));                                                        \
+        if (chunk == NULL) {                                                                                          \
+            return false;                                                                                             \
+        }                                                                                                             \
+        chunk->refs = 1;                                                                                              \
+        self->chunks[self->chunkCount++] = chunk;                                                                     \
+    } else if (!__dc4c_shared_vector_own_##name(self, index)) {                                                       \
+        return false;                                                                                                 \
+    }                                                                                                                 \
+    self->chunks[index]->content[self->count++ % DC4C_SHARED_VECTOR_CHUNK_SIZE] = value;                              \
+    return true;                                                                                                      \
+}                                                                                                                     \
+                                                                                                                      \
+static inline type shared_vector_pop_back_##name(struct shared_vector_snapshot_##name* self) {                        \
+    const size_t position = self->count - 1;                                                                          \
+    const struct shared_vector_chunk_##name* chunk = self->chunks[position / DC4C_SHARED_VECTOR_CHUNK_SIZE];          \
+    type toReturn = chunk->content[position % DC4C_SHARED_VECTOR_CHUNK_SIZE];                                         \
+    __dc4c_shared_vector_truncate_##name(self, position);                                                             \
+    return toReturn;                                                                                                  \
+}                                                                                                                     \
+                                                                                                                      \
+static inline bool shared_vector_assign_##name(struct shared_vector_snapshot_##name* self,                            \
+                                               const struct vector_##name* vector) {                                  \
+    const size_t chunkCount = (vector->count + DC4C_SHARED_VECTOR_CHUNK_SIZE - 1)                                     \
+                            / DC4C_SHARED_VECTOR_CHUNK_SIZE;                                                          \
+    if (!__dc4c_shared_vector_reserve_##name(self, chunkCount)) {                                                     \
+        return false;                                                                                                 \
+    }                                                                                                                 \
+    for (size_t i = 0; i < chunkCount; ++i) {                                                                         \
+        const size_t offset = i * DC4C_SHARED_VECTOR_CHUNK_SIZE;                                                      \
+        const size_t length = vector->count - offset < DC4C_SHARED_VECTOR_CHUNK_SIZE                                  \
+                            ? vector->count - offset : DC4C_SHARED_VECTOR_CHUNK_SIZE;                                 \
+        if (i < self->chunkCount) {                                                                                   \
+            const size_t available = self->count - offset < DC4C_SHARED_VECTOR_CHUNK_SIZE                             \
+                                   ? self->count - offset : DC4C_SHARED_VECTOR_CHUNK_SIZE;                            \
+            if (available >= length                                                                                   \
+                && memcmp(self->chunks[i]->content, vector->content + offset, length * sizeof(type)) == 0) {          \
+                continue;                                                                                             \
+            }                                                                                                         \
+            if (!__dc4c_shared_vector_own_##name(self, i)) {                                                          \
+                __dc4c_shared_vector_truncate_##name(self, offset);                                                   \
+                return false;                                                                                         \
+            }                                                                                                         \
+        } else {                                                                                                      \
+            struct shared_vector_chunk_##name* chunk = (struct shared_vector_chunk_##name*)                           \
+                malloc(sizeof(struct shared_vector_chunk_##name));                                                    \
+            if (chunk == NULL) {                                                                                      \
+                __dc4c_shared_vector_truncate_##name(self, offset);                                                   \
+                return false;                                                                                         \
+            }                                                                                                         \
+            chunk->refs = 1;                                                                                          \
+            self->chunks[self->chunkCount++] = chunk;                                                                 \
+        }                                                                                                             \
+        memcpy(self->chunks[i]->content, vector->content + offset, length * sizeof(type));                            \
+    }                                                                                                                 \
+    __dc4c_shared_vector_truncate_##name(self, vector->count);                                                        \
+    return true;                                                                                                      \
+}                                                                                                                     \
+                                                                                                                      \
+static inline void shared_vector_publish_##name(struct shared_vector_##name* self,                                    \
+                                                struct shared_vector_snapshot_##name* draft) {                        \
+    struct shared_vector_snapshot_##name* old = self->current;                                                        \
+    __atomic_store_n(&self->current, draft, __ATOMIC_SEQ_CST);                                                        \
+    __dc4c_shared_vector_synchronize(&self->rcu);                                                                     \
+    pthread_mutex_unlock(&self->rcu.writer);                                                                          \
+    shared_vector_release_##name(old);                                                                                \
+}                                                                                                                     \
+                                                                                                                      \
+static inline void shared_vector_abort_##name(struct shared_vector_##name* self,                                      \
+                                              struct shared_vector_snapshot_##name* draft) {                          \
+    pthread_mutex_unlock(&self->rcu.writer);                                                                          \
+    shared_vector_release_##name(draft);                                                                              \
+}
+
+/**
+ * @brief Defines a shared vector of the given name containing the given type.
+ *
+ * A shared vector publishes immutable snapshots of its content to any amount
+ * of reader threads. Readers access the current snapshot wait-free, writers
+ * edit a copy-on-write draft that shares all unchanged chunks with the
+ * published snapshot. Replaced snapshots are freed once no reader can see
+ * them anymore. The vector of the same name needs to be defined before.<br>
+ * The following functions are defined:
+ * - @c shared_vector_init_NAME(shared) initializes an empty shared vector, returns whether it succeeded
+ * - @c shared_vector_destroy_NAME(shared) destroys the shared vector, no reader may be active
+ * - @c shared_vector_acquire_NAME(shared) returns a reference to the current snapshot
+ * - @c shared_vector_release_NAME(snapshot) releases a reference to a snapshot or a draft
+ * - @c shared_vector_edit_NAME(shared) locks out other writers and returns a draft, or @c NULL
+ * - @c shared_vector_set_NAME(draft, position, value) replaces an element, returns whether it succeeded
+ * - @c shared_vector_push_back_NAME(draft, value) appends a value, returns whether it succeeded
+ * - @c shared_vector_pop_back_NAME(draft) removes and returns the last element
+ * - @c shared_vector_assign_NAME(draft, vector) replaces the content, keeping equal chunks shared
+ * - @c shared_vector_publish_NAME(shared, draft) publishes the draft and frees the replaced snapshot
+ * - @c shared_vector_abort_NAME(shared, draft) discards the draft
+ *
+ * @param name the name of the shared vector and of its vector
+ * @param type the contained type
+ */
+#define typedef_shared_vector_named(name, type) \
+__dc4c_shared_vector_named(name, type);         \
+__dc4c_shared_vector_methods(name, type)        \
+__dc4c_shared_vector_cxx_wrapper(name, type)    \
+typedef struct shared_vector_##name shared_vector_##name##_t
+
+/**
+ * @brief Defines a shared vector containing the given type.
+ *
+ * @param type the contained type
+ */
+#define typedef_shared_vector(type) typedef_shared_vector_named(type, type)
+
+/**
+ * @brief Executes the given block inside of a read-side critical section.
+ *
+ * The given variable points to the current snapshot, which stays valid and
+ * unchanged until the block ends. The block may leave the section using
+ * @c break , but not using @c return or @c goto . Readers never wait, not
+ * even for writers.
+ *
+ * @param sharedPtr the pointer to the shared vector
+ * @param varname the name of the variable holding a pointer to the snapshot
+ * @param block the block to be executed
+ */
+#define shared_vector_read(sharedPtr, varname, block)                                   \
+do {                                                                                    \
+    __DC4C_TYPEOF((sharedPtr)) __s_svr = (sharedPtr);                                   \
+                                                                                        \
+    for (unsigned __e_svr = __dc4c_shared_vector_read_lock(&__s_svr->rcu), __d_svr = 0; \
+         __d_svr == 0;                                                                  \
+         __dc4c_shared_vector_read_unlock(&__s_svr->rcu, __e_svr), __d_svr = 1) {       \
+        for (const __DC4C_VALUE_TYPEOF(*__s_svr->current)* varname                      \
+                 = __atomic_load_n(&__s_svr->current, __ATOMIC_SEQ_CST);                \
+             __d_svr == 0;                                                              \
+             __d_svr = 1) {                                                             \
+            { block }                                                                   \
+        }                                                                               \
+    }                                                                                   \
+} while (0)
+
+/**
+ * Returns the amount of elements of the given snapshot or draft.
+ *
+ * @param snapshotPtr the pointer to the snapshot
+ * @return the amount of elements
+ */
+#define shared_vector_size(snapshotPtr) ({ (snapshotPtr)->count; })
+
+/**
+ * @brief Returns the element at the given position of the given snapshot or draft.
+ *
+ * The position is not range checked.
+ *
+ * @param snapshotPtr the pointer to the snapshot
+ * @param position the position
+ * @return the element
+ */
+#define shared_vector_at(snapshotPtr, position) ({           \
+    __DC4C_TYPEOF((snapshotPtr)) __s_sva = (snapshotPtr);    \
+    const size_t __p_sva = (size_t) (position);              \
+                                                             \
+    __s_sva->chunks[__p_sva / DC4C_SHARED_VECTOR_CHUNK_SIZE] \
+        ->content[__p_sva % DC4C_SHARED_VECTOR_CHUNK_SIZE];  \
+})
+
+/**
+ * @brief Exposes the chunks of the given snapshot one after another as the given vector.
+ *
+ * The vector is a read-only view of the chunk, it must neither be modified nor
+ * destroyed.
+ *
+ * @param snapshotPtr the pointer to the snapshot
+ * @param vectorPtr the pointer to the vector used as view
+ * @param block the block to be executed for each chunk
+ */
+#define shared_vector_forEachChunk(snapshotPtr, vectorPtr, block)                                   \
+do {                                                                                                \
+    __DC4C_TYPEOF((snapshotPtr)) __s_svfc = (snapshotPtr);                                          \
+    __DC4C_TYPEOF((vectorPtr))   __v_svfc = (vectorPtr);                                            \
+                                                                                                    \
+    for (size_t __dc4c_i = 0; __dc4c_i < __s_svfc->chunkCount; ++__dc4c_i) {                        \
+        const size_t __o_svfc = __dc4c_i * DC4C_SHARED_VECTOR_CHUNK_SIZE;                           \
+        __v_svfc->content = (__DC4C_TYPEOF(__v_svfc->content)) __s_svfc->chunks[__dc4c_i]->content; \
+        __v_svfc->count   = __s_svfc->count - __o_svfc < DC4C_SHARED_VECTOR_CHUNK_SIZE              \
+                          ? __s_svfc->count - __o_svfc : DC4C_SHARED_VECTOR_CHUNK_SIZE;             \
+        __v_svfc->cap     = __v_svfc->count;                                                        \
+        { block }                                                                                   \
+    }                                                                                               \
+} while (0)
+
+/**
+ * Iterates over the elements of the given snapshot.
+ *
+ * @param snapshotPtr the pointer to the snapshot
+ * @param varname the name of the variable holding a pointer to the current element
+ * @param block the block to be executed
+ */
+#define shared_vector_forEach(snapshotPtr, varname, block)                                  \
+do {                                                                                        \
+    __DC4C_TYPEOF((snapshotPtr)) __s_svfe = (snapshotPtr);                                  \
+                                                                                            \
+    for (size_t __c_svfe = 0; __c_svfe < __s_svfe->chunkCount; ++__c_svfe) {                \
+        const size_t __o_svfe = __c_svfe * DC4C_SHARED_VECTOR_CHUNK_SIZE;                   \
+        const size_t __n_svfe = __s_svfe->count - __o_svfe < DC4C_SHARED_VECTOR_CHUNK_SIZE  \
+                              ? __s_svfe->count - __o_svfe : DC4C_SHARED_VECTOR_CHUNK_SIZE; \
+        for (size_t __dc4c_i = 0; __dc4c_i < __n_svfe; ++__dc4c_i) {                        \
+            const __DC4C_VALUE_TYPEOF(*__s_svfe->chunks[0]->content)* varname               \
+                = &__s_svfe->chunks[__c_svfe]->content[__dc4c_i];                           \
+            { block }                                                                       \
+        }                                                                                   \
+    }                                                                                       \
+} while (0)
+
+/**
+ * @brief Copies the elements of the given snapshot into the given vector.
+ *
+ * The elements are appended to the vector. If the allocation failed, the
+ * vector is left unchanged.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param snapshotPtr the pointer to the snapshot
+ * @return whether the elements were copied
+ */
+#define shared_vector_copy(vectorPtr, snapshotPtr) ({                                        \
+    __DC4C_TYPEOF((vectorPtr))   __v_svc = (vectorPtr);                                      \
+    __DC4C_TYPEOF((snapshotPtr)) __s_svc = (snapshotPtr);                                    \
+                                                                                             \
+    bool __svc_result = vector_reserve(__v_svc, __v_svc->count + __s_svc->count);            \
+    if (__svc_result) {                                                                      \
+        for (size_t __dc4c_i = 0; __dc4c_i < __s_svc->chunkCount; ++__dc4c_i) {              \
+            const size_t __o_svc = __dc4c_i * DC4C_SHARED_VECTOR_CHUNK_SIZE;                 \
+            const size_t __n_svc = __s_svc->count - __o_svc < DC4C_SHARED_VECTOR_CHUNK_SIZE  \
+                                 ? __s_svc->count - __o_svc : DC4C_SHARED_VECTOR_CHUNK_SIZE; \
+            memcpy(__v_svc->content + __v_svc->count, __s_svc->chunks[__dc4c_i]->content,    \
+                   __n_svc * sizeof(*__v_svc->content));                                     \
+            __v_svc->count += __n_svc;                                                       \
+        }                                                                                    \
+    }                                                                                        \
+    __svc_result;                                                                            \
+})
+
+#ifdef __cplusplus
+# include "shared_vector.hpp"
+#endif
+
+#ifndef __dc4c_shared_vector_cxx_wrapper
+# define __dc4c_shared_vector_cxx_wrapper(name, type)
+#endif
+
+#endif /* __DC4C_shared_vector_h */
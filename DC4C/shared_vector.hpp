@@ -0,0 +1,391 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_shared_vector_h
+# warning Wrong inclusion of "shared_vector.hpp" redirected to #include "shared_vector.h"!
+# include "shared_vector.h"
+#else
+# ifndef __DC4C_shared_vector_hpp
+# define __DC4C_shared_vector_hpp
+
+# include <new>
+
+namespace dc4c {
+/**
+ * The functions of a C shared vector, specialized by @c typedef_shared_vector_named .
+ *
+ * @tparam T the C DC4C shared vector type
+ */
+template<typename T>
+struct shared_vector_traits;
+
+template<typename T>
+class shared_vector;
+
+/**
+ * @brief This class holds a reference to an immutable snapshot of a shared vector.
+ *
+ * The snapshot stays valid and unchanged while this object holds it, even if
+ * newer versions are published in the meantime.
+ *
+ * @tparam T the C DC4C shared vector type
+ */
+template<typename T>
+class shared_vector_snapshot {
+    /** The functions of the C shared vector. */
+    using traits = shared_vector_traits<T>;
+
+    /** The referenced C snapshot. */
+    typename traits::snapshot_type* underlying;
+
+    friend class shared_vector<T>;
+
+    /**
+     * Takes over the given reference to a C snapshot.
+     *
+     * @param underlying the C snapshot
+     */
+    explicit inline shared_vector_snapshot(typename traits::snapshot_type* underlying) noexcept: underlying(underlying) {}
+
+public:
+    /** The type used for the size of the snapshot. */
+    using size_type = std::size_t;
+    /** The type stored in the snapshot.            */
+    using value_type = typename traits::value_type;
+
+    shared_vector_snapshot(const shared_vector_snapshot&) = delete;
+
+    inline shared_vector_snapshot(shared_vector_snapshot&& other) noexcept: underlying(other.underlying) {
+        other.underlying = nullptr;
+    }
+
+    inline ~shared_vector_snapshot() {
+        if (underlying != nullptr) {
+            traits::release(underlying);
+        }
+    }
+
+    auto operator=(const shared_vector_snapshot&) -> shared_vector_snapshot& = delete;
+
+    inline auto operator=(shared_vector_snapshot&& other) noexcept -> shared_vector_snapshot& {
+        if (this != &other) {
+            if (underlying != nullptr) {
+                traits::release(underlying);
+            }
+            underlying       = other.underlying;
+            other.underlying = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * Returns the element at the given position.
+     *
+     * @param position the position
+     * @return the element
+     */
+    inline auto operator[](size_type position) const noexcept -> const value_type& {
+        return underlying->chunks[position / DC4C_SHARED_VECTOR_CHUNK_SIZE]
+                         ->content[position % DC4C_SHARED_VECTOR_CHUNK_SIZE];
+    }
+
+    /**
+     * Returns the amount of elements held by this snapshot.
+     *
+     * @return the amount of held elements
+     */
+    inline auto size() const noexcept -> size_type {
+        return underlying->count;
+    }
+
+    /**
+     * Returns whether this snapshot is empty.
+     *
+     * @return whether no elements are held
+     */
+    inline auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    /**
+     * Returns the underlying C snapshot.
+     *
+     * @return the C snapshot
+     */
+    constexpr inline auto data() const noexcept -> const typename traits::snapshot_type& {
+        return *underlying;
+    }
+};
+
+/**
+ * @brief This class edits the draft of a shared vector.
+ *
+ * It is handed to the editing function passed to @c shared_vector::update .
+ *
+ * @tparam T the C DC4C shared vector type
+ */
+template<typename T>
+class shared_vector_editor {
+    /** The functions of the C shared vector. */
+    using traits = shared_vector_traits<T>;
+
+    /** The edited C draft. */
+    typename traits::snapshot_type* draft;
+
+    friend class shared_vector<T>;
+
+    /**
+     * Constructs an editor for the given C draft.
+     *
+     * @param draft the C draft
+     */
+    explicit inline shared_vector_editor(typename traits::snapshot_type* draft) noexcept: draft(draft) {}
+
+public:
+    /** The type used for the size of the draft. */
+    using size_type = std::size_t;
+    /** The type stored in the draft.            */
+    using value_type = typename traits::value_type;
+
+    shared_vector_editor(const shared_vector_editor&) = delete;
+
+    auto operator=(const shared_vector_editor&) -> shared_vector_editor& = delete;
+
+    /**
+     * Returns the element at the given position.
+     *
+     * @param position the position
+     * @return the element
+     */
+    inline auto operator[](size_type position) const noexcept -> const value_type& {
+        return draft->chunks[position / DC4C_SHARED_VECTOR_CHUNK_SIZE]
+                    ->content[position % DC4C_SHARED_VECTOR_CHUNK_SIZE];
+    }
+
+    /**
+     * Replaces the element at the given position.
+     *
+     * @param position the position
+     * @param value the new value
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void set(size_type position, const value_type& value) {
+        if (!traits::set(draft, position, value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Appends the given value.
+     *
+     * @param value the value to be appended
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void push_back(const value_type& value) {
+        if (!traits::push_back(draft, value)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Removes the last element.
+     */
+    inline void pop_back() noexcept {
+        traits::pop_back(draft);
+    }
+
+    /**
+     * @brief Replaces the content by the elements of the given vector.
+     *
+     * Chunks whose content is unchanged stay shared with the older snapshots.
+     *
+     * @param vector the vector whose elements to use
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline void assign(const vector<typename traits::vector_type>& vector) {
+        if (!traits::assign(draft, &vector.data())) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Returns the amount of elements held by the draft.
+     *
+     * @return the amount of held elements
+     */
+    inline auto size() const noexcept -> size_type {
+        return draft->count;
+    }
+};
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for the C shared vector of DC4C.
+ *
+ * Readers take snapshots, writers edit copy-on-write drafts which are
+ * published atomically.
+ *
+ * @tparam T the C DC4C shared vector type to be managed by this wrapper class
+ */
+template<typename T>
+class shared_vector {
+    /** The functions of the C shared vector. */
+    using traits = shared_vector_traits<T>;
+
+    /** The underlying C shared vector. */
+    T underlying;
+
+public:
+    /** The type used for the size of the shared vector. */
+    using size_type = std::size_t;
+    /** The type stored in the underlying shared vector. */
+    using value_type = typename traits::value_type;
+    /** The type of the snapshots.                       */
+    using snapshot_type = shared_vector_snapshot<T>;
+    /** The type of the editor of the drafts.            */
+    using editor_type = shared_vector_editor<T>;
+
+    /**
+     * Constructs an empty shared vector.
+     *
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline shared_vector() {
+        if (!traits::init(&underlying)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    shared_vector(const shared_vector&) = delete;
+
+    inline ~shared_vector() {
+        traits::destroy(&underlying);
+    }
+
+    auto operator=(const shared_vector&) -> shared_vector& = delete;
+
+    /**
+     * Returns the current snapshot.
+     *
+     * @return the current snapshot
+     */
+    inline auto snapshot() -> snapshot_type {
+        return snapshot_type(traits::acquire(&underlying));
+    }
+
+    /**
+     * @brief Edits a draft of the current snapshot using the given function and publishes it.
+     *
+     * The function is called with an @c editor_type . If it throws, the draft
+     * is discarded. Concurrent writers wait for each other.
+     *
+     * @param editor the editing function
+     * @throw std::bad_alloc if the allocation failed
+     */
+    template<typename F>
+    inline void update(F&& editor) {
+        auto draft = traits::edit(&underlying);
+        if (draft == nullptr) {
+            throw std::bad_alloc();
+        }
+        try {
+            editor_type editing(draft);
+            editor(editing);
+        } catch (...) {
+            traits::abort(&underlying, draft);
+            throw;
+        }
+        traits::publish(&underlying, draft);
+    }
+
+    /**
+     * Returns the underlying C shared vector.
+     *
+     * @return the C shared vector
+     */
+    __DC4C_CONSTEXPR_SINCE_CXX14 inline auto data() noexcept -> T& {
+        return underlying;
+    }
+};
+}
+
+/**
+ * Defines the C++ wrapper of the shared vector of the given name.
+ *
+ * @param name the name of the C shared vector
+ * @param type the contained type
+ */
+# define __dc4c_shared_vector_cxx_wrapper(name, type)                                               \
+namespace dc4c {                                                                                    \
+template<>                                                                                          \
+struct shared_vector_traits<::shared_vector_##name> {                                               \
+    using value_type    = type;                                                                     \
+    using snapshot_type = ::shared_vector_snapshot_##name;                                          \
+    using vector_type   = ::vector_##name;                                                          \
+                                                                                                    \
+    static inline auto init(::shared_vector_##name* self) -> bool {                                 \
+        return shared_vector_init_##name(self);                                                     \
+    }                                                                                               \
+                                                                                                    \
+    static inline void destroy(::shared_vector_##name* self) {                                      \
+        shared_vector_destroy_##name(self);                                                         \
+    }                                                                                               \
+                                                                                                    \
+    static inline auto acquire(::shared_vector_##name* self) -> snapshot_type* {                    \
+        return shared_vector_acquire_##name(self);                                                  \
+    }                                                                                               \
+                                                                                                    \
+    static inline void release(snapshot_type* snapshot) {                                           \
+        shared_vector_release_##name(snapshot);                                                     \
+    }                                                                                               \
+                                                                                                    \
+    static inline auto edit(::shared_vector_##name* self) -> snapshot_type* {                       \
+        return shared_vector_edit_##name(self);                                                     \
+    }                                                                                               \
+                                                                                                    \
+    static inline auto set(snapshot_type* draft, std::size_t position, const type& value) -> bool { \
+        return shared_vector_set_##name(draft, position, value);                                    \
+    }                                                                                               \
+                                                                                                    \
+    static inline auto push_back(snapshot_type* draft, const type& value) -> bool {                 \
+        return shared_vector_push_back_##name(draft, value);                                        \
+    }                                                                                               \
+                                                                                                    \
+    static inline void pop_back(snapshot_type* draft) {                                             \
+        shared_vector_pop_back_##name(draft);                                                       \
+    }                                                                                               \
+                                                                                                    \
+    static inline auto assign(snapshot_type* draft, const vector_type* vector) -> bool {            \
+        return shared_vector_assign_##name(draft, vector);                                          \
+    }                                                                                               \
+                                                                                                    \
+    static inline void publish(::shared_vector_##name* self, snapshot_type* draft) {                \
+        shared_vector_publish_##name(self, draft);                                                  \
+    }                                                                                               \
+                                                                                                    \
+    static inline void abort(::shared_vector_##name* self, snapshot_type* draft) {                  \
+        shared_vector_abort_##name(self, draft);                                                    \
+    }                                                                                               \
+};                                                                                                  \
+}                                                                                                   \
+namespace dc4c {                                                                                    \
+using shared_vector_##name = shared_vector<::shared_vector_##name>;                                 \
+}
+
+# endif /* __DC4C_shared_vector_hpp */
+#endif /* !__DC4C_shared_vector_h */
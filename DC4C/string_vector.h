@@ -0,0 +1,578 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_string_vector_h
+#define __DC4C_string_vector_h
+
+#if __STDC_VERSION__ < 202311L
+# include <stdbool.h>
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** The position returned by the interning if the allocation failed. */
+#define STRING_VECTOR_NPOS SIZE_MAX
+
+/**
+ * The position and length of one string inside of the arena of a string vector.
+ */
+struct __dc4c_string_vector_entry {
+    /** The offset of the first character inside of the arena. */
+    size_t offset;
+    /** The length of the string without its terminator.       */
+    size_t length;
+};
+
+/**
+ * @brief The string vector structure.
+ *
+ * The characters of all strings are stored contiguously in one arena, each
+ * string is terminated by a null character. The strings are referred to by
+ * their offset and length inside of the arena, so reordering the strings only
+ * permutes these entries.<br>
+ * The hash index used by the interning is built lazily and only covers the
+ * first @c indexed strings.
+ */
+struct string_vector {
+    /** The amount of stored strings.                      */
+    size_t                             count;
+    /** The amount of strings the vector is able to hold. */
+    size_t                             cap;
+    /** The entries referring to the strings.             */
+    struct __dc4c_string_vector_entry* entries;
+    /** The amount of used bytes of the arena.            */
+    size_t                             arenaSize;
+    /** The amount of bytes the arena is able to hold.    */
+    size_t                             arenaCap;
+    /** The arena holding the characters.                 */
+    char*                              arena;
+    /** The amount of strings covered by the hash index.  */
+    size_t                             indexed;
+    /** The amount of slots of the hash index.            */
+    size_t                             indexCap;
+    /** The slots of the hash index, positions plus one.  */
+    size_t*                            index;
+};
+
+typedef struct string_vector string_vector_t;
+
+/** The initial values for a string vector. */
+#define string_vector_initializer { 0, 0, NULL, 0, 0, NULL, 0, 0, NULL }
+
+/**
+ * Initializes the given string vector.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ */
+#define string_vector_init(stringVectorPtr)         \
+do {                                                \
+    string_vector_t* __sv_svin = (stringVectorPtr); \
+                                                    \
+    __sv_svin->count     = 0;                       \
+    __sv_svin->cap       = 0;                       \
+    __sv_svin->entries   = NULL;                    \
+    __sv_svin->arenaSize = 0;                       \
+    __sv_svin->arenaCap  = 0;                       \
+    __sv_svin->arena     = NULL;                    \
+    __sv_svin->indexed   = 0;                       \
+    __sv_svin->indexCap  = 0;                       \
+    __sv_svin->index     = NULL;                    \
+} while (0)
+
+/**
+ * @brief Allocates enough storage for the given string vector to hold at least
+ * the given amount of strings and characters.
+ *
+ * The characters include the terminators of the strings. If the allocation
+ * failed, the strings are left unchanged.
+ *
+ * @param self the string vector
+ * @param count the amount of strings
+ * @param bytes the amount of bytes of the arena
+ * @return whether the string vector holds enough memory
+ */
+static inline bool __dc4c_string_vector_reserve(string_vector_t* self, size_t count, size_t bytes) {
+    if (self->cap < count) {
+        struct __dc4c_string_vector_entry* tmp = (struct __dc4c_string_vector_entry*)
+            realloc(self->entries, count * sizeof(*self->entries));
+        if (tmp == NULL) {
+            return false;
+        }
+        self->entries = tmp;
+        self->cap     = count;
+    }
+    if (self->arenaCap < bytes) {
+        char* tmp = (char*) realloc(self->arena, bytes);
+        if (tmp == NULL) {
+            return false;
+        }
+        self->arena    = tmp;
+        self->arenaCap = bytes;
+    }
+    return true;
+}
+
+/**
+ * @brief Allocates enough storage for the given string vector to hold at least
+ * the given amount of strings and characters.
+ *
+ * The characters include the terminators of the strings. Growing the arena
+ * invalidates the pointers to the stored strings. If the allocation failed,
+ * the strings are left unchanged.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param count the amount of strings the string vector should be able to hold
+ * @param bytes the amount of bytes the arena should be able to hold
+ * @return whether the string vector holds enough memory
+ */
+#define string_vector_reserve(stringVectorPtr, count, bytes)                            \
+    __dc4c_string_vector_reserve((stringVectorPtr), (size_t) (count), (size_t) (bytes))
+
+/**
+ * @brief Appends a copy of the given characters to the given string vector.
+ *
+ * Runs in amortized constant time per character. The characters may be part
+ * of the arena of the string vector itself.
+ *
+ * @param self the string vector
+ * @param string the characters to be appended
+ * @param length the amount of characters
+ * @return whether the string was appended
+ */
+static inline bool __dc4c_string_vector_push_back(string_vector_t* self, const char* string, size_t length) {
+    const bool stored = self->arena != NULL
+                     && (uintptr_t) string >= (uintptr_t) self->arena
+                     && (uintptr_t) string <  (uintptr_t) (self->arena + self->arenaSize);
+    const size_t offset = stored ? (size_t) ((uintptr_t) string - (uintptr_t) self->arena) : 0;
+
+    size_t count = self->cap;
+    size_t bytes = self->arenaCap;
+    if (count < self->count + 1) {
+        count = count == 0 ? 16 : count * 2;
+    }
+    while (bytes < self->arenaSize + length + 1) {
+        bytes = bytes == 0 ? 256 : bytes * 2;
+    }
+    if (!__dc4c_string_vector_reserve(self, count, bytes)) {
+        return false;
+    }
+    if (stored) {
+        string = self->arena + offset;
+    }
+
+    struct __dc4c_string_vector_entry* entry = &self->entries[self->count++];
+    entry->offset = self->arenaSize;
+    entry->length = length;
+    memcpy(self->arena + self->arenaSize, string, length);
+    self->arena[self->arenaSize + length] = '\0';
+    self->arenaSize += length + 1;
+    return true;
+}
+
+/**
+ * @brief Appends a copy of the given characters to the given string vector.
+ *
+ * The characters may contain null characters and may be taken from the
+ * string vector itself. If the allocation failed, the strings are left
+ * unchanged.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param string the characters to be appended
+ * @param length the amount of characters
+ * @return whether the string was appended
+ */
+#define string_vector_push_back_n(stringVectorPtr, string, length)                 \
+    __dc4c_string_vector_push_back((stringVectorPtr), (string), (size_t) (length))
+
+/**
+ * @brief Appends a copy of the given null terminated string to the given string vector.
+ *
+ * The string may be one of the strings of the string vector itself. If the
+ * allocation failed, the strings are left unchanged.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param string the string to be appended
+ * @return whether the string was appended
+ */
+#define string_vector_push_back(stringVectorPtr, string) ({                        \
+    const char* __s_svpb = (string);                                               \
+    __dc4c_string_vector_push_back((stringVectorPtr), __s_svpb, strlen(__s_svpb)); \
+})
+
+/**
+ * Discards the hash index of the given string vector.
+ *
+ * @param self the string vector
+ */
+static inline void __dc4c_string_vector_drop_index(string_vector_t* self) {
+    if (self->indexed > 0) {
+        memset(self->index, 0, self->indexCap * sizeof(*self->index));
+        self->indexed = 0;
+    }
+}
+
+/**
+ * @brief Removes the last string of the given string vector.
+ *
+ * Its characters are only released if they are the last ones of the arena.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ */
+#define string_vector_pop_back(stringVectorPtr)                                                     \
+do {                                                                                                \
+    string_vector_t* __sv_svpob = (stringVectorPtr);                                                \
+                                                                                                    \
+    const struct __dc4c_string_vector_entry* __e_svpob = &__sv_svpob->entries[--__sv_svpob->count]; \
+    if (__e_svpob->offset + __e_svpob->length + 1 == __sv_svpob->arenaSize) {                       \
+        __sv_svpob->arenaSize = __e_svpob->offset;                                                  \
+    }                                                                                               \
+    if (__sv_svpob->indexed > __sv_svpob->count) {                                                  \
+        __dc4c_string_vector_drop_index(__sv_svpob);                                                \
+    }                                                                                               \
+} while (0)
+
+/**
+ * Removes all strings of the given string vector, keeping its memory.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ */
+#define string_vector_clear(stringVectorPtr)       \
+do {                                               \
+    string_vector_t* __sv_svc = (stringVectorPtr); \
+                                                   \
+    __sv_svc->count     = 0;                       \
+    __sv_svc->arenaSize = 0;                       \
+    __dc4c_string_vector_drop_index(__sv_svc);     \
+} while (0)
+
+/**
+ * @brief Returns the string at the given position.
+ *
+ * The returned string is null terminated. It stays valid until the arena of
+ * the string vector grows. The position is not range checked.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param position the position
+ * @return the string
+ */
+#define string_vector_get(stringVectorPtr, position) ({                     \
+    const string_vector_t* __sv_svg = (stringVectorPtr);                    \
+    (const char*) (__sv_svg->arena + __sv_svg->entries[(position)].offset); \
+})
+
+/**
+ * @brief Returns the length of the string at the given position.
+ *
+ * The position is not range checked.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param position the position
+ * @return the length of the string without its terminator
+ */
+#define string_vector_length(stringVectorPtr, position) ({ (stringVectorPtr)->entries[(position)].length; })
+
+/**
+ * Returns the amount of strings stored in the given string vector.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @return the amount of strings
+ */
+#define string_vector_size(stringVectorPtr) ({ (stringVectorPtr)->count; })
+
+/**
+ * Returns the amount of bytes used by the characters of the given string vector.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @return the amount of used bytes, including the terminators
+ */
+#define string_vector_bytes(stringVectorPtr) ({ (stringVectorPtr)->arenaSize; })
+
+/**
+ * Iterates over the strings of the given string vector.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param stringName the name of the variable holding the current string
+ * @param lengthName the name of the variable holding the length of the current string
+ * @param block the block to be executed
+ */
+#define string_vector_forEach(stringVectorPtr, stringName, lengthName, block)            \
+do {                                                                                     \
+    const string_vector_t* __sv_svfe = (stringVectorPtr);                                \
+                                                                                         \
+    for (size_t __dc4c_i = 0; __dc4c_i < __sv_svfe->count; ++__dc4c_i) {                 \
+        const char* stringName = __sv_svfe->arena + __sv_svfe->entries[__dc4c_i].offset; \
+        size_t      lengthName = __sv_svfe->entries[__dc4c_i].length;                    \
+        (void) lengthName;                                                               \
+        { block }                                                                        \
+    }                                                                                    \
+} while (0)
+
+/**
+ * Compares the two given strings bytewise.
+ *
+ * @param arena the arena of the strings
+ * @param lhs the first string
+ * @param rhs the second string
+ * @return a negative value, zero or a positive value if the first string is smaller, equal or greater
+ */
+static inline int __dc4c_string_vector_compare(const char* arena,
+                                               const struct __dc4c_string_vector_entry* lhs,
+                                               const struct __dc4c_string_vector_entry* rhs) {
+    const int toReturn = memcmp(arena + lhs->offset, arena + rhs->offset,
+                                lhs->length < rhs->length ? lhs->length : rhs->length);
+    if (toReturn != 0) {
+        return toReturn;
+    }
+    return (lhs->length > rhs->length) - (lhs->length < rhs->length);
+}
+
+/**
+ * @brief Sorts the strings of the given string vector bytewise.
+ *
+ * The sort is stable. Only the entries are permuted, the characters stay in
+ * place.
+ *
+ * @param self the string vector
+ * @return whether the temporary memory could be allocated
+ */
+static inline bool __dc4c_string_vector_sort(string_vector_t* self) {
+    if (self->count < 2) {
+        return true;
+    }
+    struct __dc4c_string_vector_entry* buffer = (struct __dc4c_string_vector_entry*)
+        malloc(self->count * sizeof(*buffer));
+    if (buffer == NULL) {
+        return false;
+    }
+    struct __dc4c_string_vector_entry* from = self->entries;
+    struct __dc4c_string_vector_entry* to   = buffer;
+    for (size_t width = 1; width < self->count; width *= 2) {
+        for (size_t begin = 0; begin < self->count; begin += 2 * width) {
+            const size_t middle = begin + width < self->count ? begin + width : self->count;
+            const size_t end    = middle + width < self->count ? middle + width : self->count;
+
+            size_t i = begin, j = middle, k = begin;
+            while (i < middle && j < end) {
+                to[k++] = __dc4c_string_vector_compare(self->arena, &from[j], &from[i]) < 0 ? from[j++] : from[i++];
+            }
+            while (i < middle) to[k++] = from[i++];
+            while (j < end)    to[k++] = from[j++];
+        }
+        struct __dc4c_string_vector_entry* tmp = from;
+        from = to;
+        to   = tmp;
+    }
+    if (from != self->entries) {
+        memcpy(self->entries, from, self->count * sizeof(*from));
+    }
+    free(buffer);
+    __dc4c_string_vector_drop_index(self);
+    return true;
+}
+
+/**
+ * @brief Sorts the strings of the given string vector bytewise.
+ *
+ * The sort is stable and only permutes the offsets of the strings, no
+ * characters are moved. If the temporary memory could not be allocated, the
+ * string vector is left unchanged.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @return whether the string vector was sorted
+ */
+#define string_vector_sort(stringVectorPtr) __dc4c_string_vector_sort((stringVectorPtr))
+
+/**
+ * Hashes the given characters using FNV-1a.
+ *
+ * @param string the characters
+ * @param length the amount of characters
+ * @return the hash value
+ */
+static inline uint64_t __dc4c_string_vector_hash(const char* string, size_t length) {
+    uint64_t toReturn = UINT64_C(0xcbf29ce484222325);
+    for (size_t i = 0; i < length; ++i) {
+        toReturn = (toReturn ^ (unsigned char) string[i]) * UINT64_C(0x100000001b3);
+    }
+    return toReturn;
+}
+
+/**
+ * @brief Returns the slot of the hash index holding the given string or the
+ * empty slot where it would be inserted.
+ *
+ * The hash index needs to have at least one empty slot.
+ *
+ * @param self the string vector
+ * @param string the characters
+ * @param length the amount of characters
+ * @return the slot
+ */
+static inline size_t* __dc4c_string_vector_probe(const string_vector_t* self, const char* string, size_t length) {
+    const size_t mask = self->indexCap - 1;
+    for (size_t slot = (size_t) __dc4c_string_vector_hash(string, length) & mask;; slot = (slot + 1) & mask) {
+        const size_t position = self->index[slot];
+        if (position == 0) {
+            return &self->index[slot];
+        }
+        const struct __dc4c_string_vector_entry* entry = &self->entries[position - 1];
+        if (entry->length == length && memcmp(self->arena + entry->offset, string, length) == 0) {
+            return &self->index[slot];
+        }
+    }
+}
+
+/**
+ * @brief Adds the strings not yet covered to the hash index of the given string vector.
+ *
+ * The hash index is kept at most half full. Of equal strings, the first one
+ * stays indexed.
+ *
+ * @param self the string vector
+ * @param count the amount of strings the hash index should be able to cover
+ * @return whether the hash index could be allocated
+ */
+static inline bool __dc4c_string_vector_update_index(string_vector_t* self, size_t count) {
+    if (self->indexCap < 2 * count) {
+        size_t indexCap = self->indexCap == 0 ? 32 : self->indexCap;
+        while (indexCap < 2 * count) {
+            indexCap *= 2;
+        }
+        size_t* tmp = (size_t*) calloc(indexCap, sizeof(size_t));
+        if (tmp == NULL) {
+            return false;
+        }
+        free(self->index);
+        self->index    = tmp;
+        self->indexCap = indexCap;
+        self->indexed  = 0;
+    }
+    for (; self->indexed < self->count; ++self->indexed) {
+        const struct __dc4c_string_vector_entry* entry = &self->entries[self->indexed];
+
+        size_t* slot = __dc4c_string_vector_probe(self, self->arena + entry->offset, entry->length);
+        if (*slot == 0) {
+            *slot = self->indexed + 1;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the position of a string equal to the given characters,
+ * appending them if no such string is stored yet.
+ *
+ * Runs in amortized constant time.
+ *
+ * @param self the string vector
+ * @param string the characters
+ * @param length the amount of characters
+ * @return the position of the string or @c STRING_VECTOR_NPOS if the allocation failed
+ */
+static inline size_t __dc4c_string_vector_intern(string_vector_t* self, const char* string, size_t length) {
+    if (!__dc4c_string_vector_update_index(self, self->count + 1)) {
+        return STRING_VECTOR_NPOS;
+    }
+    size_t* slot = __dc4c_string_vector_probe(self, string, length);
+    if (*slot != 0) {
+        return *slot - 1;
+    }
+    if (!__dc4c_string_vector_push_back(self, string, length)) {
+        return STRING_VECTOR_NPOS;
+    }
+    *slot = self->indexed++ + 1;
+    return self->count - 1;
+}
+
+/**
+ * @brief Returns the position of a string equal to the given characters,
+ * appending them if no such string is stored yet.
+ *
+ * The lookup uses a hash index that is built on first use and kept up to date
+ * incrementally. Sorting the string vector or removing strings discards it.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param string the characters
+ * @param length the amount of characters
+ * @return the position of the string or @c STRING_VECTOR_NPOS if the allocation failed
+ */
+#define string_vector_intern_n(stringVectorPtr, string, length)                 \
+    __dc4c_string_vector_intern((stringVectorPtr), (string), (size_t) (length))
+
+/**
+ * @brief Returns the position of a string equal to the given null terminated
+ * string, appending it if no such string is stored yet.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ * @param string the string
+ * @return the position of the string or @c STRING_VECTOR_NPOS if the allocation failed
+ */
+#define string_vector_intern(stringVectorPtr, string) ({                      \
+    const char* __s_svi = (string);                                           \
+    __dc4c_string_vector_intern((stringVectorPtr), __s_svi, strlen(__s_svi)); \
+})
+
+/**
+ * @brief Copies the given string vector.
+ *
+ * The hash index is not copied. If the allocation failed, the destination
+ * string vector is empty.
+ *
+ * @param lhsPtr the pointer to the destination string vector, it is overwritten
+ * @param rhsPtr the pointer to the string vector to be copied
+ */
+#define string_vector_copy(lhsPtr, rhsPtr)                                                              \
+do {                                                                                                    \
+    string_vector_t*       __l_svcp = (lhsPtr);                                                         \
+    const string_vector_t* __r_svcp = (rhsPtr);                                                         \
+                                                                                                        \
+    string_vector_init(__l_svcp);                                                                       \
+    if (__dc4c_string_vector_reserve(__l_svcp, __r_svcp->count, __r_svcp->arenaSize)) {                 \
+        if (__r_svcp->count > 0) {                                                                      \
+            memcpy(__l_svcp->entries, __r_svcp->entries, __r_svcp->count * sizeof(*__r_svcp->entries)); \
+        }                                                                                               \
+        if (__r_svcp->arenaSize > 0) {                                                                  \
+            memcpy(__l_svcp->arena, __r_svcp->arena, __r_svcp->arenaSize);                              \
+        }                                                                                               \
+        __l_svcp->count     = __r_svcp->count;                                                          \
+        __l_svcp->arenaSize = __r_svcp->arenaSize;                                                      \
+    } else {                                                                                            \
+        free(__l_svcp->entries);                                                                        \
+        free(__l_svcp->arena);                                                                          \
+        string_vector_init(__l_svcp);                                                                   \
+    }                                                                                                   \
+} while (0)
+
+/**
+ * Destroys the given string vector.
+ *
+ * @param stringVectorPtr the pointer to the string vector
+ */
+#define string_vector_destroy(stringVectorPtr)     \
+do {                                               \
+    string_vector_t* __sv_svd = (stringVectorPtr); \
+                                                   \
+    free(__sv_svd->entries);                       \
+    free(__sv_svd->arena);                         \
+    free(__sv_svd->index);                         \
+} while (0)
+
+#ifdef __cplusplus
+# include "string_vector.hpp"
+#endif
+
+#endif /* __DC4C_string_vector_h */
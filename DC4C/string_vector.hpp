@@ -0,0 +1,452 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_string_vector_h
+# warning Wrong inclusion of "string_vector.hpp" redirected to #include "string_vector.h"!
+# include "string_vector.h"
+#else
+# ifndef __DC4C_string_vector_hpp
+# define __DC4C_string_vector_hpp
+
+# include <cstring>
+# include <iterator>
+# include <new>
+# include <string>
+# include <vector>
+
+# if __cplusplus >= 201703L
+#  include <string_view>
+# endif
+
+namespace dc4c {
+/**
+ * @brief This class acts as a RAII compatible wrapper class for the C string
+ * vector of DC4C.
+ *
+ * Since C++17, the strings are also accessible as @c std::string_view and the
+ * string vector is iterable.
+ */
+class string_vector {
+    /** The underlying C string vector. */
+    string_vector_t underlying;
+
+public:
+    /** The type used for the size of the string vector. */
+    using size_type = std::size_t;
+
+    inline string_vector(): underlying(string_vector_initializer) {}
+
+    inline string_vector(const string_vector& other) {
+        string_vector_copy(&underlying, &other.underlying);
+        if (underlying.count != other.underlying.count) {
+            throw std::bad_alloc();
+        }
+    }
+
+    inline string_vector(string_vector&& other) noexcept: underlying(other.underlying) {
+        string_vector_init(&other.underlying);
+    }
+
+    /**
+     * Constructs a DC4C string vector from the given C++ @c std::vector .
+     *
+     * @param other the C++ standard vector of strings to be copied
+     * @throw std::bad_alloc if the allocation failed
+     */
+    inline string_vector(const std::vector<std::string>& other): underlying(string_vector_initializer) {
+        std::size_t bytes = 0;
+        for (const auto& string : other) {
+            bytes += string.size() + 1;
+        }
+        reserve(other.size(), bytes);
+
+        for (const auto& string : other) {
+            push_back(string);
+        }
+    }
+
+    inline ~string_vector() {
+        string_vector_destroy(&underlying);
+    }
+
+    inline auto operator=(const string_vector& other) -> string_vector& {
+        if (this != &other) {
+            string_vector_destroy(&underlying);
+            string_vector_copy(&underlying, &other.underlying);
+            if (underlying.count != other.underlying.count) {
+                throw std::bad_alloc();
+            }
+        }
+        return *this;
+    }
+
+    inline auto operator=(string_vector&& other) noexcept -> string_vector& {
+        string_vector_destroy(&underlying);
+        underlying = other.underlying;
+        string_vector_init(&other.underlying);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the underlying C string vector.
+     *
+     * It is safe to manipulate the returned DC4C C string vector.
+     *
+     * @return the underlying C string vector
+     */
+    inline auto data() -> string_vector_t& {
+        return underlying;
+    }
+
+    /**
+     * @brief Returns the underlying C string vector.
+     *
+     * @return the underlying C string vector
+     */
+    constexpr inline auto data() const -> const string_vector_t& {
+        return underlying;
+    }
+
+    inline operator std::vector<std::string>() const {
+        auto toReturn = std::vector<std::string>();
+        toReturn.reserve(size());
+        string_vector_forEach(&underlying, string, length, {
+            toReturn.emplace_back(string, length);
+        });
+        return toReturn;
+    }
+
+    /**
+     * @brief Returns the null terminated string at the given position.
+     *
+     * The position is not range checked. The string stays valid until the
+     * next string is added.
+     *
+     * @param position the position
+     * @return the string
+     */
+    inline auto operator[](size_type position) const noexcept -> const char* {
+        return string_vector_get(&underlying, position);
+    }
+
+    /**
+     * @brief Returns the length of the string at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     * @return the length of the string
+     */
+    inline auto length(size_type position) const noexcept -> size_type {
+        return string_vector_length(&underlying, position);
+    }
+
+# if __cplusplus >= 201703L
+    /**
+     * @brief Returns a view of the string at the given position.
+     *
+     * The position is not range checked. The view stays valid until the next
+     * string is added.
+     *
+     * @param position the position
+     * @return the view of the string
+     */
+    inline auto view(size_type position) const noexcept -> std::string_view {
+        return std::string_view(string_vector_get(&underlying, position), string_vector_length(&underlying, position));
+    }
+
+    /**
+     * This class iterates over the strings of a string vector as views.
+     */
+    class const_iterator {
+        /** The iterated string vector. */
+        const string_vector_t* vector;
+        /** The current position.       */
+        size_type position;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::string_view;
+
+        constexpr inline const_iterator() noexcept: vector(nullptr), position(0) {}
+
+        constexpr inline const_iterator(const string_vector_t* vector, size_type position) noexcept:
+            vector(vector), position(position) {}
+
+        inline auto operator*() const noexcept -> std::string_view {
+            return (*this)[0];
+        }
+
+        inline auto operator[](difference_type offset) const noexcept -> std::string_view {
+            const auto& entry = vector->entries[position + offset];
+            return std::string_view(vector->arena + entry.offset, entry.length);
+        }
+
+        constexpr inline auto operator++() noexcept -> const_iterator& {
+            ++position;
+            return *this;
+        }
+
+        constexpr inline auto operator--() noexcept -> const_iterator& {
+            --position;
+            return *this;
+        }
+
+        constexpr inline auto operator++(int) noexcept -> const_iterator {
+            auto toReturn = *this;
+            ++position;
+            return toReturn;
+        }
+
+        constexpr inline auto operator--(int) noexcept -> const_iterator {
+            auto toReturn = *this;
+            --position;
+            return toReturn;
+        }
+
+        constexpr inline auto operator+=(difference_type offset) noexcept -> const_iterator& {
+            position += offset;
+            return *this;
+        }
+
+        constexpr inline auto operator-=(difference_type offset) noexcept -> const_iterator& {
+            position -= offset;
+            return *this;
+        }
+
+        constexpr inline auto operator+(difference_type offset) const noexcept -> const_iterator {
+            return const_iterator(vector, position + offset);
+        }
+
+        constexpr inline auto operator-(difference_type offset) const noexcept -> const_iterator {
+            return const_iterator(vector, position - offset);
+        }
+
+        constexpr inline auto operator-(const const_iterator& other) const noexcept -> difference_type {
+            return static_cast<difference_type>(position) - static_cast<difference_type>(other.position);
+        }
+
+        constexpr inline auto operator==(const const_iterator& other) const noexcept -> bool {
+            return position == other.position;
+        }
+
+        constexpr inline auto operator!=(const const_iterator& other) const noexcept -> bool {
+            return position != other.position;
+        }
+
+        constexpr inline auto operator<(const const_iterator& other) const noexcept -> bool {
+            return position < other.position;
+        }
+
+        constexpr inline auto operator>(const const_iterator& other) const noexcept -> bool {
+            return position > other.position;
+        }
+
+        constexpr inline auto operator<=(const const_iterator& other) const noexcept -> bool {
+            return position <= other.position;
+        }
+
+        constexpr inline auto operator>=(const const_iterator& other) const noexcept -> bool {
+            return position >= other.position;
+        }
+    };
+
+    /**
+     * Returns an iterator to the first string.
+     *
+     * @return an iterator to the first string
+     */
+    constexpr inline auto begin() const noexcept -> const_iterator {
+        return const_iterator(&underlying, 0);
+    }
+
+    /**
+     * Returns a past the end iterator.
+     *
+     * @return an iterator past the last string
+     */
+    constexpr inline auto end() const noexcept -> const_iterator {
+        return const_iterator(&underlying, underlying.count);
+    }
+
+    /**
+     * Appends a copy of the given string.
+     *
+     * @param string the string to be appended
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void push_back(std::string_view string) {
+        push_back(string.data(), string.size());
+    }
+
+    /**
+     * Returns the position of a string equal to the given one, appending it if necessary.
+     *
+     * @param string the string to be interned
+     * @return the position of the string
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline auto intern(std::string_view string) -> size_type {
+        return intern(string.data(), string.size());
+    }
+# endif
+
+    /**
+     * Appends a copy of the given null terminated string.
+     *
+     * @param string the string to be appended
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void push_back(const char* string) {
+        push_back(string, std::strlen(string));
+    }
+
+    /**
+     * Appends a copy of the given string.
+     *
+     * @param string the string to be appended
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void push_back(const std::string& string) {
+        push_back(string.data(), string.size());
+    }
+
+    /**
+     * Appends a copy of the given characters.
+     *
+     * @param string the characters to be appended
+     * @param length the amount of characters
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void push_back(const char* string, size_type length) {
+        if (!string_vector_push_back_n(&underlying, string, length)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Returns the position of a string equal to the given one, appending it if necessary.
+     *
+     * @param string the null terminated string to be interned
+     * @return the position of the string
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline auto intern(const char* string) -> size_type {
+        return intern(string, std::strlen(string));
+    }
+
+    /**
+     * Returns the position of a string equal to the given one, appending it if necessary.
+     *
+     * @param string the string to be interned
+     * @return the position of the string
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline auto intern(const std::string& string) -> size_type {
+        return intern(string.data(), string.size());
+    }
+
+    /**
+     * Returns the position of a string equal to the given characters, appending them if necessary.
+     *
+     * @param string the characters to be interned
+     * @param length the amount of characters
+     * @return the position of the string
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline auto intern(const char* string, size_type length) -> size_type {
+        const auto toReturn = string_vector_intern_n(&underlying, string, length);
+        if (toReturn == STRING_VECTOR_NPOS) {
+            throw std::bad_alloc();
+        }
+        return toReturn;
+    }
+
+    /**
+     * Removes the last string.
+     */
+    inline void pop_back() noexcept {
+        string_vector_pop_back(&underlying);
+    }
+
+    /**
+     * Removes all strings.
+     */
+    inline void clear() noexcept {
+        string_vector_clear(&underlying);
+    }
+
+    /**
+     * Sorts the strings bytewise by permuting their offsets.
+     *
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void sort() {
+        if (!string_vector_sort(&underlying)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Reserves enough memory for the given amount of strings and characters.
+     *
+     * @param count the amount of strings
+     * @param bytes the amount of characters, including the terminators
+     * @throw std::bad_alloc if the memory allocation failed
+     */
+    inline void reserve(size_type count, size_type bytes) {
+        if (!string_vector_reserve(&underlying, count, bytes)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    /**
+     * Returns the amount of strings stored in this string vector.
+     *
+     * @return the amount of strings
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.count;
+    }
+
+    /**
+     * Returns whether this string vector is empty.
+     *
+     * @return whether no strings are stored
+     */
+    constexpr inline auto empty() const noexcept -> bool {
+        return underlying.count == 0;
+    }
+
+    /**
+     * Returns the amount of bytes used by the characters.
+     *
+     * @return the amount of used bytes, including the terminators
+     */
+    constexpr inline auto bytes() const noexcept -> size_type {
+        return underlying.arenaSize;
+    }
+};
+}
+
+# endif /* __DC4C_string_vector_hpp */
+#endif /* !__DC4C_string_vector_h */
@@ -25,6 +25,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef DC4C_VECTOR_STATS
+# include "vector_stats.h"
+#else
+# define __dc4c_vector_stats_key(name)
+# define __dc4c_vector_stats_initializer
+# define __dc4c_vector_stats_register(name, type)
+# define __dc4c_vector_stats_grow(vectorPtr, newCap) ((void) 0)
+# define __dc4c_vector_stats_move(vectorPtr, bytes)  ((void) 0)
+# define __dc4c_vector_stats_copy(vectorPtr, bytes)  ((void) 0)
+# define __dc4c_vector_stats_destroy(vectorPtr)      ((void) 0)
+#endif
+
 /**
  * Defines the vector structure.
  *
@@ -36,12 +48,16 @@ struct vector_##name {                  \
     size_t count;                       \
     size_t cap;                         \
     type*  content;                     \
+    __dc4c_vector_stats_key(name)       \
 }
 
 #ifdef __cplusplus
+# include <type_traits>
 # define __DC4C_TYPEOF(expr) decltype(expr)
+# define __DC4C_VALUE_TYPEOF(expr) typename std::remove_reference<decltype(expr)>::type
 #else
 # define __DC4C_TYPEOF(expr) typeof(expr)
+# define __DC4C_VALUE_TYPEOF(expr) typeof(expr)
 #endif
 
 /**
@@ -70,6 +86,7 @@ struct vector_##name {                  \
         if (__vr_tmp == NULL) {                                                    \
             break;                                                                 \
         }                                                                          \
+        __dc4c_vector_stats_grow(__v_vr, __s_vr);                                  \
                                                                                    \
         __v_vr->content = __vr_tmp;                                                \
         __v_vr->cap     = __s_vr;                                                  \
@@ -164,6 +181,8 @@ do {                            \
         memmove(&__v_vi->content[__p_vi + 1],                         \
                 &__v_vi->content[__p_vi],                             \
                 (__v_vi->count - __p_vi) * sizeof(*__v_vi->content)); \
+        __dc4c_vector_stats_move(__v_vi, (__v_vi->count - __p_vi)     \
+                                         * sizeof(*__v_vi->content)); \
         __v_vi->content[__p_vi] = __vl_vi;                            \
         ++__v_vi->count;                                              \
         __vi_result = true;                                           \
@@ -188,6 +207,8 @@ do {                            \
     memmove(&__v_ve->content[__p_ve],                                        \
             &__v_ve->content[__p_ve + 1],                                    \
             (--__v_ve->count - __p_ve) * sizeof(*__v_ve->content));          \
+    __dc4c_vector_stats_move(__v_ve, (__v_ve->count - __p_ve)                \
+                                     * sizeof(*__v_ve->content));            \
     __ve_toReturn;                                                           \
 })
 
@@ -285,6 +306,758 @@ do {                                                       \
     __vse_toReturn;                                                     \
 })
 
+/**
+ * Returns whether the first given element is ordered before the second one.
+ *
+ * @param comp the comparison function
+ * @param lhsPtr the pointer to the first element
+ * @param rhsPtr the pointer to the second element
+ */
+#define __dc4c_vector_less(comp, lhsPtr, rhsPtr) (comp((lhsPtr), (rhsPtr)) < 0)
+
+/**
+ * Returns whether the first given element is ordered after the second one.
+ *
+ * @param comp the comparison function
+ * @param lhsPtr the pointer to the first element
+ * @param rhsPtr the pointer to the second element
+ */
+#define __dc4c_vector_greater(comp, lhsPtr, rhsPtr) (comp((lhsPtr), (rhsPtr)) > 0)
+
+/**
+ * @brief Moves the element at the given position of the given binary heap
+ * down to its place.
+ *
+ * The heap is ordered such that no parent is placed before any of its
+ * children by the given ordering.
+ *
+ * @param content the array holding the heap
+ * @param count the amount of elements in the heap
+ * @param position the position of the element to be moved
+ * @param before the ordering, either @c __dc4c_vector_less or @c __dc4c_vector_greater
+ * @param comp the comparison function
+ */
+#define __dc4c_vector_sift_down(content, count, position, before, comp)                            \
+do {                                                                                               \
+    size_t                          __p_vsd  = (position);                                         \
+    const size_t                    __n_vsd  = (count);                                            \
+    __DC4C_VALUE_TYPEOF(*(content)) __vl_vsd = (content)[__p_vsd];                                 \
+                                                                                                   \
+    for (;;) {                                                                                     \
+        size_t __c_vsd = 2 * __p_vsd + 1;                                                          \
+        if (__c_vsd >= __n_vsd) {                                                                  \
+            break;                                                                                 \
+        }                                                                                          \
+        if (__c_vsd + 1 < __n_vsd && before(comp, &(content)[__c_vsd], &(content)[__c_vsd + 1])) { \
+            ++__c_vsd;                                                                             \
+        }                                                                                          \
+        if (!before(comp, &__vl_vsd, &(content)[__c_vsd])) {                                       \
+            break;                                                                                 \
+        }                                                                                          \
+        (content)[__p_vsd] = (content)[__c_vsd];                                                   \
+        __p_vsd = __c_vsd;                                                                         \
+    }                                                                                              \
+    (content)[__p_vsd] = __vl_vsd;                                                                 \
+} while (0)
+
+/**
+ * @brief Moves the element at the given position of the given binary heap up
+ * to its place.
+ *
+ * @param content the array holding the heap
+ * @param position the position of the element to be moved
+ * @param before the ordering, either @c __dc4c_vector_less or @c __dc4c_vector_greater
+ * @param comp the comparison function
+ */
+#define __dc4c_vector_sift_up(content, position, before, comp)     \
+do {                                                               \
+    size_t                          __p_vsu  = (position);         \
+    __DC4C_VALUE_TYPEOF(*(content)) __vl_vsu = (content)[__p_vsu]; \
+                                                                   \
+    while (__p_vsu > 0) {                                          \
+        const size_t __pa_vsu = (__p_vsu - 1) / 2;                 \
+        if (!before(comp, &(content)[__pa_vsu], &__vl_vsu)) {      \
+            break;                                                 \
+        }                                                          \
+        (content)[__p_vsu] = (content)[__pa_vsu];                  \
+        __p_vsu = __pa_vsu;                                        \
+    }                                                              \
+    (content)[__p_vsu] = __vl_vsu;                                 \
+} while (0)
+
+/**
+ * Sorts the given amount of the smallest elements of the given array into
+ * its beginning.
+ *
+ * @param content the array
+ * @param count the amount of elements in the array
+ * @param k the amount of elements to be sorted
+ * @param comp the comparison function
+ */
+#define __dc4c_vector_partial_sort(content, count, k, comp)                                 \
+do {                                                                                        \
+    const size_t __n_vps = (count);                                                         \
+    const size_t __k_vps = (k) < __n_vps ? (k) : __n_vps;                                   \
+                                                                                            \
+    for (size_t __dc4c_i = __k_vps / 2; __dc4c_i-- > 0;) {                                  \
+        __dc4c_vector_sift_down(content, __k_vps, __dc4c_i, __dc4c_vector_less, comp);      \
+    }                                                                                       \
+    for (size_t __dc4c_i = __k_vps; __dc4c_i < __n_vps; ++__dc4c_i) {                       \
+        if (__k_vps > 0 && __dc4c_vector_less(comp, &(content)[__dc4c_i], &(content)[0])) { \
+            __DC4C_VALUE_TYPEOF(*(content)) __t_vps = (content)[0];                         \
+            (content)[0]        = (content)[__dc4c_i];                                      \
+            (content)[__dc4c_i] = __t_vps;                                                  \
+            __dc4c_vector_sift_down(content, __k_vps, 0, __dc4c_vector_less, comp);         \
+        }                                                                                   \
+    }                                                                                       \
+    for (size_t __dc4c_i = __k_vps; __dc4c_i-- > 1;) {                                      \
+        __DC4C_VALUE_TYPEOF(*(content)) __t_vps = (content)[0];                             \
+        (content)[0]        = (content)[__dc4c_i];                                          \
+        (content)[__dc4c_i] = __t_vps;                                                      \
+        __dc4c_vector_sift_down(content, __dc4c_i, 0, __dc4c_vector_less, comp);            \
+    }                                                                                       \
+} while (0)
+
+/**
+ * @brief Sorts the given amount of the smallest elements of the given vector
+ * into its beginning.
+ *
+ * The order of the remaining elements is unspecified. The comparison function
+ * is called directly with pointers to the elements. Runs in O(n log k).
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param k the amount of elements to be sorted
+ * @param comp the comparison function
+ */
+#define vector_partial_sort(vectorPtr, k, comp)                                \
+do {                                                                           \
+    __DC4C_TYPEOF((vectorPtr)) __v_vpsr = (vectorPtr);                         \
+    __DC4C_TYPEOF(__v_vpsr->content) __c_vpsr = __v_vpsr->content;             \
+                                                                               \
+    __dc4c_vector_partial_sort(__c_vpsr, __v_vpsr->count, (size_t) (k), comp); \
+} while (0)
+
+/**
+ * @brief Partially sorts the given vector such that the element at the given
+ * position is the one that would be there if the vector was sorted.
+ *
+ * All elements in front of the given position are not greater and all
+ * elements after it are not smaller than the element at the given position.
+ * The comparison function is called directly with pointers to the elements.
+ * Runs in O(n) on average and in O(n log n) in the worst case.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param position the position of the element to be put into place
+ * @param comp the comparison function
+ */
+#define vector_nth_element(vectorPtr, position, comp)                                                            \
+do {                                                                                                             \
+    __DC4C_TYPEOF((vectorPtr))      __v_vne   = (vectorPtr);                                                     \
+    __DC4C_TYPEOF(__v_vne->content) __c_vne   = __v_vne->content;                                                \
+    const size_t                    __nth_vne = (size_t) (position);                                             \
+                                                                                                                 \
+    if (__nth_vne >= __v_vne->count) {                                                                           \
+        break;                                                                                                   \
+    }                                                                                                            \
+    size_t __lo_vne = 0,                                                                                         \
+           __hi_vne = __v_vne->count,                                                                            \
+           __d_vne  = 0;                                                                                         \
+    for (size_t __s_vne = __hi_vne; __s_vne > 1; __s_vne /= 2) {                                                 \
+        __d_vne += 2;                                                                                            \
+    }                                                                                                            \
+    while (__hi_vne - __lo_vne > 16) {                                                                           \
+        if (__d_vne-- == 0) {                                                                                    \
+            __DC4C_TYPEOF(__c_vne) __b_vne = __c_vne + __lo_vne;                                                 \
+            __dc4c_vector_partial_sort(__b_vne, __hi_vne - __lo_vne, __nth_vne - __lo_vne + 1, comp);            \
+            __lo_vne = __hi_vne;                                                                                 \
+            break;                                                                                               \
+        }                                                                                                        \
+                                                                                                                 \
+        size_t __m_vne = __lo_vne + (__hi_vne - __lo_vne) / 2,                                                   \
+               __l_vne = __hi_vne - 1;                                                                           \
+        __DC4C_VALUE_TYPEOF(*__c_vne) __t_vne;                                                                   \
+        if (__dc4c_vector_less(comp, &__c_vne[__m_vne], &__c_vne[__lo_vne])) {                                   \
+            __t_vne = __c_vne[__m_vne]; __c_vne[__m_vne] = __c_vne[__lo_vne]; __c_vne[__lo_vne] = __t_vne;       \
+        }                                                                                                        \
+        if (__dc4c_vector_less(comp, &__c_vne[__l_vne], &__c_vne[__m_vne])) {                                    \
+            __t_vne = __c_vne[__m_vne]; __c_vne[__m_vne] = __c_vne[__l_vne]; __c_vne[__l_vne] = __t_vne;         \
+            if (__dc4c_vector_less(comp, &__c_vne[__m_vne], &__c_vne[__lo_vne])) {                               \
+                __t_vne = __c_vne[__m_vne]; __c_vne[__m_vne] = __c_vne[__lo_vne]; __c_vne[__lo_vne] = __t_vne;   \
+            }                                                                                                    \
+        }                                                                                                        \
+                                                                                                                 \
+        const __DC4C_VALUE_TYPEOF(*__c_vne) __pv_vne = __c_vne[__m_vne];                                         \
+        size_t __i_vne = __lo_vne,                                                                               \
+               __j_vne = __hi_vne;                                                                               \
+        for (;;) {                                                                                               \
+            while (__dc4c_vector_less(comp, &__c_vne[__i_vne], &__pv_vne)) ++__i_vne;                            \
+            do --__j_vne; while (__dc4c_vector_less(comp, &__pv_vne, &__c_vne[__j_vne]));                        \
+            if (__i_vne >= __j_vne) {                                                                            \
+                break;                                                                                           \
+            }                                                                                                    \
+            __t_vne = __c_vne[__i_vne]; __c_vne[__i_vne] = __c_vne[__j_vne]; __c_vne[__j_vne] = __t_vne;         \
+            ++__i_vne;                                                                                           \
+        }                                                                                                        \
+        if (__nth_vne <= __j_vne) {                                                                              \
+            __hi_vne = __j_vne + 1;                                                                              \
+        } else {                                                                                                 \
+            __lo_vne = __j_vne + 1;                                                                              \
+        }                                                                                                        \
+    }                                                                                                            \
+    for (size_t __dc4c_i = __lo_vne + 1; __dc4c_i < __hi_vne; ++__dc4c_i) {                                      \
+        __DC4C_VALUE_TYPEOF(*__c_vne) __vl_vne = __c_vne[__dc4c_i];                                              \
+        size_t __dc4c_j = __dc4c_i;                                                                              \
+        for (; __dc4c_j > __lo_vne && __dc4c_vector_less(comp, &__vl_vne, &__c_vne[__dc4c_j - 1]); --__dc4c_j) { \
+            __c_vne[__dc4c_j] = __c_vne[__dc4c_j - 1];                                                           \
+        }                                                                                                        \
+        __c_vne[__dc4c_j] = __vl_vne;                                                                            \
+    }                                                                                                            \
+} while (0)
+
+/**
+ * @brief Offers the given value to the given vector keeping the greatest
+ * values seen so far.
+ *
+ * The vector is used as a bounded heap holding at most the given amount of
+ * elements: as long as fewer elements are held, the value is added, otherwise
+ * it replaces the smallest held element if it is greater. Use
+ * @c vector_top_k_sort to sort the held elements afterwards. Runs in O(log k).
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param k the amount of greatest elements to be kept
+ * @param value the offered value
+ * @param comp the comparison function
+ * @return whether the value was handled successfully, @c false if the allocation failed
+ */
+#define vector_top_k(vectorPtr, k, value, comp) ({                                                \
+    bool __vtk_result = true;                                                                     \
+    do {                                                                                          \
+        __DC4C_TYPEOF((vectorPtr)) __v_vtk  = (vectorPtr);                                        \
+        __DC4C_TYPEOF((value))     __vl_vtk = (value);                                            \
+        const size_t               __k_vtk  = (size_t) (k);                                       \
+                                                                                                  \
+        if (__v_vtk->count < __k_vtk) {                                                           \
+            if (!vector_push_back(__v_vtk, __vl_vtk)) {                                           \
+                __vtk_result = false;                                                             \
+                break;                                                                            \
+            }                                                                                     \
+            __DC4C_TYPEOF(__v_vtk->content) __c_vtk = __v_vtk->content;                           \
+            __dc4c_vector_sift_up(__c_vtk, __v_vtk->count - 1, __dc4c_vector_greater, comp);      \
+        } else if (__k_vtk > 0 && __dc4c_vector_greater(comp, &__vl_vtk, &__v_vtk->content[0])) { \
+            __DC4C_TYPEOF(__v_vtk->content) __c_vtk = __v_vtk->content;                           \
+            __c_vtk[0] = __vl_vtk;                                                                \
+            __dc4c_vector_sift_down(__c_vtk, __v_vtk->count, 0, __dc4c_vector_greater, comp);     \
+        }                                                                                         \
+    } while (0);                                                                                  \
+    __vtk_result;                                                                                 \
+})
+
+/**
+ * Sorts the elements collected by @c vector_top_k in descending order.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param comp the comparison function
+ */
+#define vector_top_k_sort(vectorPtr, comp)                                           \
+do {                                                                                 \
+    __DC4C_TYPEOF((vectorPtr))       __v_vtks = (vectorPtr);                         \
+    __DC4C_TYPEOF(__v_vtks->content) __c_vtks = __v_vtks->content;                   \
+                                                                                     \
+    for (size_t __dc4c_i = __v_vtks->count; __dc4c_i-- > 1;) {                       \
+        __DC4C_VALUE_TYPEOF(*__c_vtks) __t_vtks = __c_vtks[0];                       \
+        __c_vtks[0]        = __c_vtks[__dc4c_i];                                     \
+        __c_vtks[__dc4c_i] = __t_vtks;                                               \
+        __dc4c_vector_sift_down(__c_vtks, __dc4c_i, 0, __dc4c_vector_greater, comp); \
+    }                                                                                \
+} while (0)
+
+/**
+ * The size ratio of two sorted vectors from which on the set operations
+ * search the elements of the smaller one in the larger one using galloping
+ * instead of merging them linearly. Can be defined before including this
+ * header.
+ */
+#ifndef DC4C_VECTOR_GALLOP_RATIO
+# define DC4C_VECTOR_GALLOP_RATIO 32
+#endif
+
+/**
+ * @brief Searches the first element not ordered before the given key in the
+ * given sorted range using galloping.
+ *
+ * The distance to the found element is probed exponentially before it is
+ * searched binary, making the search O(log d) for a distance of d.
+ *
+ * @param content the sorted array
+ * @param begin the beginning of the range to be searched
+ * @param end the past the end index of the range to be searched
+ * @param keyPtr the pointer to the searched key
+ * @param comp the comparison function
+ * @return the index of the found element or @c end if none was found
+ */
+#define __dc4c_vector_gallop(content, begin, end, keyPtr, comp) ({                       \
+    size_t       __lo_vg   = (begin);                                                    \
+    const size_t __end_vg  = (end);                                                      \
+    size_t       __step_vg = 1;                                                          \
+                                                                                         \
+    while (__lo_vg + __step_vg <= __end_vg                                               \
+           && __dc4c_vector_less(comp, &(content)[__lo_vg + __step_vg - 1], (keyPtr))) { \
+        __lo_vg   += __step_vg;                                                          \
+        __step_vg *= 2;                                                                  \
+    }                                                                                    \
+    size_t __hi_vg = __lo_vg + __step_vg <= __end_vg ? __lo_vg + __step_vg - 1           \
+                                                     : __end_vg;                         \
+    while (__lo_vg < __hi_vg) {                                                          \
+        const size_t __m_vg = __lo_vg + (__hi_vg - __lo_vg) / 2;                         \
+        if (__dc4c_vector_less(comp, &(content)[__m_vg], (keyPtr))) {                    \
+            __lo_vg = __m_vg + 1;                                                        \
+        } else {                                                                         \
+            __hi_vg = __m_vg;                                                            \
+        }                                                                                \
+    }                                                                                    \
+    __lo_vg;                                                                             \
+})
+
+/**
+ * @brief Merges the two given sorted vectors into the given destination vector.
+ *
+ * The merged elements are added at the end of the destination vector, which
+ * must not be one of the merged vectors. Equal elements of the first vector
+ * are placed in front of the ones of the second vector. The memory is
+ * allocated once; if the allocation failed, the content of the destination
+ * vector is left unchanged.
+ *
+ * @param destPtr the pointer to the destination vector
+ * @param lhsPtr the pointer to the first sorted vector
+ * @param rhsPtr the pointer to the second sorted vector
+ * @param comp the comparison function used to sort the vectors
+ * @return whether the vectors were merged successfully
+ */
+#define vector_merge(destPtr, lhsPtr, rhsPtr, comp) ({                                              \
+    bool __vm_result = false;                                                                       \
+    do {                                                                                            \
+        __DC4C_TYPEOF((destPtr)) __v_d_vm = (destPtr);                                              \
+        __DC4C_TYPEOF((lhsPtr))  __v_l_vm = (lhsPtr);                                               \
+        __DC4C_TYPEOF((rhsPtr))  __v_r_vm = (rhsPtr);                                               \
+                                                                                                    \
+        if (!vector_reserve(__v_d_vm, __v_d_vm->count + __v_l_vm->count + __v_r_vm->count)) {       \
+            break;                                                                                  \
+        }                                                                                           \
+        size_t __i_vm = 0,                                                                          \
+               __j_vm = 0;                                                                          \
+        while (__i_vm < __v_l_vm->count && __j_vm < __v_r_vm->count) {                              \
+            if (__dc4c_vector_less(comp, &__v_r_vm->content[__j_vm], &__v_l_vm->content[__i_vm])) { \
+                __v_d_vm->content[__v_d_vm->count++] = __v_r_vm->content[__j_vm++];                 \
+            } else {                                                                                \
+                __v_d_vm->content[__v_d_vm->count++] = __v_l_vm->content[__i_vm++];                 \
+            }                                                                                       \
+        }                                                                                           \
+        for (; __i_vm < __v_l_vm->count; ++__i_vm) {                                                \
+            __v_d_vm->content[__v_d_vm->count++] = __v_l_vm->content[__i_vm];                       \
+        }                                                                                           \
+        for (; __j_vm < __v_r_vm->count; ++__j_vm) {                                                \
+            __v_d_vm->content[__v_d_vm->count++] = __v_r_vm->content[__j_vm];                       \
+        }                                                                                           \
+        __vm_result = true;                                                                         \
+    } while (0);                                                                                    \
+    __vm_result;                                                                                    \
+})
+
+/**
+ * @brief Adds the union of the two given sorted vectors to the given
+ * destination vector.
+ *
+ * Elements found in both vectors are taken from the first vector. An element
+ * contained m times in the first and n times in the second vector is added
+ * max(m, n) times. The destination vector must not be one of the given
+ * vectors. The memory is allocated once; if the allocation failed, the
+ * content of the destination vector is left unchanged.
+ *
+ * @param destPtr the pointer to the destination vector
+ * @param lhsPtr the pointer to the first sorted vector
+ * @param rhsPtr the pointer to the second sorted vector
+ * @param comp the comparison function used to sort the vectors
+ * @return whether the union was built successfully
+ */
+#define vector_set_union(destPtr, lhsPtr, rhsPtr, comp) ({                                        \
+    bool __vsu_result = false;                                                                    \
+    do {                                                                                          \
+        __DC4C_TYPEOF((destPtr)) __v_d_vsu = (destPtr);                                           \
+        __DC4C_TYPEOF((lhsPtr))  __v_l_vsu = (lhsPtr);                                            \
+        __DC4C_TYPEOF((rhsPtr))  __v_r_vsu = (rhsPtr);                                            \
+                                                                                                  \
+        if (!vector_reserve(__v_d_vsu, __v_d_vsu->count + __v_l_vsu->count + __v_r_vsu->count)) { \
+            break;                                                                                \
+        }                                                                                         \
+        size_t __i_vsu = 0,                                                                       \
+               __j_vsu = 0;                                                                       \
+        while (__i_vsu < __v_l_vsu->count && __j_vsu < __v_r_vsu->count) {                        \
+            const int __c_vsu = comp(&__v_l_vsu->content[__i_vsu], &__v_r_vsu->content[__j_vsu]); \
+            if (__c_vsu > 0) {                                                                    \
+                __v_d_vsu->content[__v_d_vsu->count++] = __v_r_vsu->content[__j_vsu++];           \
+            } else {                                                                              \
+                __v_d_vsu->content[__v_d_vsu->count++] = __v_l_vsu->content[__i_vsu++];           \
+                if (__c_vsu == 0) {                                                               \
+                    ++__j_vsu;                                                                    \
+                }                                                                                 \
+            }                                                                                     \
+        }                                                                                         \
+        for (; __i_vsu < __v_l_vsu->count; ++__i_vsu) {                                           \
+            __v_d_vsu->content[__v_d_vsu->count++] = __v_l_vsu->content[__i_vsu];                 \
+        }                                                                                         \
+        for (; __j_vsu < __v_r_vsu->count; ++__j_vsu) {                                           \
+            __v_d_vsu->content[__v_d_vsu->count++] = __v_r_vsu->content[__j_vsu];                 \
+        }                                                                                         \
+        __vsu_result = true;                                                                      \
+    } while (0);                                                                                  \
+    __vsu_result;                                                                                 \
+})
+
+/**
+ * @brief Adds the intersection of the two given sorted vectors to the given
+ * destination vector.
+ *
+ * The elements are taken from the first vector. An element contained m times
+ * in the first and n times in the second vector is added min(m, n) times. If
+ * one vector is at least @c DC4C_VECTOR_GALLOP_RATIO times larger than the
+ * other one, the elements of the smaller one are searched in the larger one
+ * using galloping. The destination vector must not be one of the given
+ * vectors. The memory is allocated once; if the allocation failed, the
+ * content of the destination vector is left unchanged.
+ *
+ * @param destPtr the pointer to the destination vector
+ * @param lhsPtr the pointer to the first sorted vector
+ * @param rhsPtr the pointer to the second sorted vector
+ * @param comp the comparison function used to sort the vectors
+ * @return whether the intersection was built successfully
+ */
+#define vector_set_intersection(destPtr, lhsPtr, rhsPtr, comp) ({                                            \
+    bool __vsi_result = false;                                                                               \
+    do {                                                                                                     \
+        __DC4C_TYPEOF((destPtr)) __v_d_vsi = (destPtr);                                                      \
+        __DC4C_TYPEOF((lhsPtr))  __v_l_vsi = (lhsPtr);                                                       \
+        __DC4C_TYPEOF((rhsPtr))  __v_r_vsi = (rhsPtr);                                                       \
+        const size_t __nl_vsi = __v_l_vsi->count,                                                            \
+                     __nr_vsi = __v_r_vsi->count;                                                            \
+                                                                                                             \
+        if (!vector_reserve(__v_d_vsi, __v_d_vsi->count + (__nl_vsi < __nr_vsi ? __nl_vsi : __nr_vsi))) {    \
+            break;                                                                                           \
+        }                                                                                                    \
+        size_t __i_vsi = 0,                                                                                  \
+               __j_vsi = 0;                                                                                  \
+        if (__nl_vsi * DC4C_VECTOR_GALLOP_RATIO <= __nr_vsi) {                                               \
+            for (; __i_vsi < __nl_vsi; ++__i_vsi) {                                                          \
+                __j_vsi = __dc4c_vector_gallop(__v_r_vsi->content, __j_vsi, __nr_vsi,                        \
+                                               &__v_l_vsi->content[__i_vsi], comp);                          \
+                if (__j_vsi == __nr_vsi) {                                                                   \
+                    break;                                                                                   \
+                }                                                                                            \
+                if (!__dc4c_vector_less(comp, &__v_l_vsi->content[__i_vsi], &__v_r_vsi->content[__j_vsi])) { \
+                    __v_d_vsi->content[__v_d_vsi->count++] = __v_l_vsi->content[__i_vsi];                    \
+                    ++__j_vsi;                                                                               \
+                }                                                                                            \
+            }                                                                                                \
+        } else if (__nr_vsi * DC4C_VECTOR_GALLOP_RATIO <= __nl_vsi) {                                        \
+            for (; __j_vsi < __nr_vsi; ++__j_vsi) {                                                          \
+                __i_vsi = __dc4c_vector_gallop(__v_l_vsi->content, __i_vsi, __nl_vsi,                        \
+                                               &__v_r_vsi->content[__j_vsi], comp);                          \
+                if (__i_vsi == __nl_vsi) {                                                                   \
+                    break;                                                                                   \
+                }                                                                                            \
+                if (!__dc4c_vector_less(comp, &__v_r_vsi->content[__j_vsi], &__v_l_vsi->content[__i_vsi])) { \
+                    __v_d_vsi->content[__v_d_vsi->count++] = __v_l_vsi->content[__i_vsi++];                  \
+                }                                                                                            \
+            }                                                                                                \
+        } else {                                                                                             \
+            while (__i_vsi < __nl_vsi && __j_vsi < __nr_vsi) {                                               \
+                const int __c_vsi = comp(&__v_l_vsi->content[__i_vsi], &__v_r_vsi->content[__j_vsi]);        \
+                if (__c_vsi < 0) {                                                                           \
+                    ++__i_vsi;                                                                               \
+                } else if (__c_vsi > 0) {                                                                    \
+                    ++__j_vsi;                                                                               \
+                } else {                                                                                     \
+                    __v_d_vsi->content[__v_d_vsi->count++] = __v_l_vsi->content[__i_vsi++];                  \
+                    ++__j_vsi;                                                                               \
+                }                                                                                            \
+            }                                                                                                \
+        }                                                                                                    \
+        __vsi_result = true;                                                                                 \
+    } while (0);                                                                                             \
+    __vsi_result;                                                                                            \
+})
+
+/**
+ * @brief Adds the elements of the first given sorted vector that are not
+ * contained in the second given sorted vector to the given destination vector.
+ *
+ * An element contained m times in the first and n times in the second vector
+ * is added max(m - n, 0) times. If the second vector is at least
+ * @c DC4C_VECTOR_GALLOP_RATIO times larger than the first one, the elements of
+ * the first one are searched in the second one using galloping. The
+ * destination vector must not be one of the given vectors. The memory is
+ * allocated once; if the allocation failed, the content of the destination
+ * vector is left unchanged.
+ *
+ * @param destPtr the pointer to the destination vector
+ * @param lhsPtr the pointer to the first sorted vector
+ * @param rhsPtr the pointer to the sorted vector whose elements are removed
+ * @param comp the comparison function used to sort the vectors
+ * @return whether the difference was built successfully
+ */
+#define vector_set_difference(destPtr, lhsPtr, rhsPtr, comp) ({                                                   \
+    bool __vsd_result = false;                                                                                    \
+    do {                                                                                                          \
+        __DC4C_TYPEOF((destPtr)) __v_d_vsd = (destPtr);                                                           \
+        __DC4C_TYPEOF((lhsPtr))  __v_l_vsd = (lhsPtr);                                                            \
+        __DC4C_TYPEOF((rhsPtr))  __v_r_vsd = (rhsPtr);                                                            \
+        const size_t __nl_vsd = __v_l_vsd->count,                                                                 \
+                     __nr_vsd = __v_r_vsd->count;                                                                 \
+                                                                                                                  \
+        if (!vector_reserve(__v_d_vsd, __v_d_vsd->count + __nl_vsd)) {                                            \
+            break;                                                                                                \
+        }                                                                                                         \
+        size_t __i_vsd = 0,                                                                                       \
+               __j_vsd = 0;                                                                                       \
+        const bool __g_vsd = __nl_vsd * DC4C_VECTOR_GALLOP_RATIO <= __nr_vsd;                                     \
+        for (; __i_vsd < __nl_vsd && __j_vsd < __nr_vsd; ++__i_vsd) {                                             \
+            if (__g_vsd) {                                                                                        \
+                __j_vsd = __dc4c_vector_gallop(__v_r_vsd->content, __j_vsd, __nr_vsd,                             \
+                                               &__v_l_vsd->content[__i_vsd], comp);                               \
+            } else {                                                                                              \
+                while (__j_vsd < __nr_vsd                                                                         \
+                       && __dc4c_vector_less(comp, &__v_r_vsd->content[__j_vsd], &__v_l_vsd->content[__i_vsd])) { \
+                    ++__j_vsd;                                                                                    \
+                }                                                                                                 \
+            }                                                                                                     \
+            if (__j_vsd < __nr_vsd                                                                                \
+                && !__dc4c_vector_less(comp, &__v_l_vsd->content[__i_vsd], &__v_r_vsd->content[__j_vsd])) {       \
+                ++__j_vsd;                                                                                        \
+            } else {                                                                                              \
+                __v_d_vsd->content[__v_d_vsd->count++] = __v_l_vsd->content[__i_vsd];                             \
+            }                                                                                                     \
+        }                                                                                                         \
+        for (; __i_vsd < __nl_vsd; ++__i_vsd) {                                                                   \
+            __v_d_vsd->content[__v_d_vsd->count++] = __v_l_vsd->content[__i_vsd];                                 \
+        }                                                                                                         \
+        __vsd_result = true;                                                                                      \
+    } while (0);                                                                                                  \
+    __vsd_result;                                                                                                 \
+})
+
+/**
+ * @brief Removes consecutive equal elements of the given vector.
+ *
+ * Only the first element of each group of consecutive elements comparing
+ * equal is kept. If the vector is sorted, all duplicates are removed.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param comp the comparison function
+ * @return the new amount of elements in the vector
+ */
+#define vector_unique(vectorPtr, comp) ({                                              \
+    __DC4C_TYPEOF((vectorPtr)) __v_vu = (vectorPtr);                                   \
+                                                                                       \
+    if (__v_vu->count > 1) {                                                           \
+        size_t __o_vu = 1;                                                             \
+        for (size_t __dc4c_i = 1; __dc4c_i < __v_vu->count; ++__dc4c_i) {              \
+            if (comp(&__v_vu->content[__o_vu - 1], &__v_vu->content[__dc4c_i]) != 0) { \
+                __v_vu->content[__o_vu++] = __v_vu->content[__dc4c_i];                 \
+            }                                                                          \
+        }                                                                              \
+        __v_vu->count = __o_vu;                                                        \
+    }                                                                                  \
+    __v_vu->count;                                                                     \
+})
+
+/** The length of the runs sorted by insertion before being merged by @c __dc4c_vector_argsort . */
+#define __DC4C_VECTOR_ARGSORT_RUN 16
+
+/**
+ * @brief Stores the indices of the elements of the given array into the given
+ * array of indices, stably sorted by the elements.
+ *
+ * Only the indices are moved, the elements are left in place.
+ *
+ * @param indices the array receiving the sorted indices
+ * @param buffer an array of the same size used for merging
+ * @param content the array of elements
+ * @param count the amount of elements
+ * @param comp the comparison function
+ */
+#define __dc4c_vector_argsort(indices, buffer, content, count, comp)                                                \
+do {                                                                                                                \
+    size_t*      __s_vas = (indices);                                                                               \
+    size_t*      __d_vas = (buffer);                                                                                \
+    const size_t __n_vas = (count);                                                                                 \
+                                                                                                                    \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_vas; ++__dc4c_i) {                                                     \
+        __s_vas[__dc4c_i] = __dc4c_i;                                                                               \
+    }                                                                                                               \
+    for (size_t __b_vas = 0; __b_vas < __n_vas; __b_vas += __DC4C_VECTOR_ARGSORT_RUN) {                             \
+        const size_t __e_vas = __n_vas - __b_vas < __DC4C_VECTOR_ARGSORT_RUN                                        \
+                             ? __n_vas : __b_vas + __DC4C_VECTOR_ARGSORT_RUN;                                       \
+        for (size_t __dc4c_i = __b_vas + 1; __dc4c_i < __e_vas; ++__dc4c_i) {                                       \
+            const size_t __x_vas = __s_vas[__dc4c_i];                                                               \
+            size_t       __j_vas = __dc4c_i;                                                                        \
+            for (; __j_vas > __b_vas                                                                                \
+                   && __dc4c_vector_less(comp, &(content)[__x_vas], &(content)[__s_vas[__j_vas - 1]]); --__j_vas) { \
+                __s_vas[__j_vas] = __s_vas[__j_vas - 1];                                                            \
+            }                                                                                                       \
+            __s_vas[__j_vas] = __x_vas;                                                                             \
+        }                                                                                                           \
+    }                                                                                                               \
+    for (size_t __w_vas = __DC4C_VECTOR_ARGSORT_RUN; __w_vas < __n_vas; __w_vas *= 2) {                             \
+        for (size_t __lo_vas = 0; __lo_vas < __n_vas; __lo_vas += 2 * __w_vas) {                                    \
+            const size_t __m_vas  = __n_vas - __lo_vas < __w_vas ? __n_vas : __lo_vas + __w_vas;                    \
+            const size_t __hi_vas = __n_vas - __m_vas < __w_vas ? __n_vas : __m_vas + __w_vas;                      \
+            size_t __l_vas = __lo_vas,                                                                              \
+                   __r_vas = __m_vas,                                                                               \
+                   __o_vas = __lo_vas;                                                                              \
+            while (__l_vas < __m_vas && __r_vas < __hi_vas) {                                                       \
+                __d_vas[__o_vas++] = __dc4c_vector_less(comp, &(content)[__s_vas[__r_vas]],                         \
+                                                        &(content)[__s_vas[__l_vas]])                               \
+                                   ? __s_vas[__r_vas++] : __s_vas[__l_vas++];                                       \
+            }                                                                                                       \
+            memcpy(__d_vas + __o_vas, __s_vas + __l_vas, (__m_vas - __l_vas) * sizeof(size_t));                     \
+            __o_vas += __m_vas - __l_vas;                                                                           \
+            memcpy(__d_vas + __o_vas, __s_vas + __r_vas, (__hi_vas - __r_vas) * sizeof(size_t));                    \
+        }                                                                                                           \
+        size_t* __t_vas = __s_vas;                                                                                  \
+        __s_vas = __d_vas;                                                                                          \
+        __d_vas = __t_vas;                                                                                          \
+    }                                                                                                               \
+    if (__s_vas != (indices)) {                                                                                     \
+        memcpy((indices), __s_vas, __n_vas * sizeof(size_t));                                                       \
+    }                                                                                                               \
+} while (0)
+
+/**
+ * @brief Reorders the given array such that each position holds the element
+ * previously stored at the index given for that position.
+ *
+ * Each cycle of the permutation is followed once, moving every element once.
+ * The visited indices are marked using their highest bit, which is cleared
+ * again afterwards.
+ *
+ * @param content the array of elements
+ * @param indices the permutation
+ * @param count the amount of elements
+ */
+#define __dc4c_vector_permute(content, indices, count)                 \
+do {                                                                   \
+    size_t*      __p_vpe = (indices);                                  \
+    const size_t __n_vpe = (count);                                    \
+    const size_t __m_vpe = ~(~(size_t) 0 >> 1);                        \
+                                                                       \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_vpe; ++__dc4c_i) {        \
+        if ((__p_vpe[__dc4c_i] & __m_vpe) != 0) {                      \
+            continue;                                                  \
+        }                                                              \
+        __DC4C_VALUE_TYPEOF(*(content)) __t_vpe = (content)[__dc4c_i]; \
+        size_t __j_vpe = __dc4c_i;                                     \
+        for (;;) {                                                     \
+            const size_t __k_vpe = __p_vpe[__j_vpe];                   \
+            __p_vpe[__j_vpe] |= __m_vpe;                               \
+            if (__k_vpe == __dc4c_i) {                                 \
+                break;                                                 \
+            }                                                          \
+            (content)[__j_vpe] = (content)[__k_vpe];                   \
+            __j_vpe = __k_vpe;                                         \
+        }                                                              \
+        (content)[__j_vpe] = __t_vpe;                                  \
+    }                                                                  \
+    for (size_t __dc4c_i = 0; __dc4c_i < __n_vpe; ++__dc4c_i) {        \
+        __p_vpe[__dc4c_i] &= ~__m_vpe;                                 \
+    }                                                                  \
+} while (0)
+
+/**
+ * @brief Stores the indices of the elements of the given vector into the given
+ * vector of indices, sorted by the elements.
+ *
+ * The vector of indices needs to contain @c size_t , as defined by
+ * @c typedef_vector(size_t) , its previous content is replaced. The sort is
+ * stable and moves only the indices, which makes it suitable for large
+ * elements and for multiple orderings of the same elements. The comparison
+ * function is called directly with pointers to the elements. If the
+ * allocation failed, the vector of indices is left unchanged.
+ *
+ * @param indicesPtr the pointer to the vector of indices
+ * @param vectorPtr the pointer to the vector
+ * @param comp the comparison function
+ * @return whether the indices were stored
+ */
+#define vector_argsort(indicesPtr, vectorPtr, comp) ({                                                \
+    __DC4C_TYPEOF((indicesPtr)) __i_vasr = (indicesPtr);                                              \
+    __DC4C_TYPEOF((vectorPtr))  __v_vasr = (vectorPtr);                                               \
+                                                                                                      \
+    bool    __vasr_result = false;                                                                    \
+    size_t* __b_vasr      = (size_t*) malloc(__v_vasr->count * sizeof(size_t) + 1);                   \
+    if (__b_vasr != NULL && vector_reserve(__i_vasr, __v_vasr->count)) {                              \
+        __dc4c_vector_argsort(__i_vasr->content, __b_vasr, __v_vasr->content, __v_vasr->count, comp); \
+        __i_vasr->count = __v_vasr->count;                                                            \
+        __vasr_result   = true;                                                                       \
+    }                                                                                                 \
+    free(__b_vasr);                                                                                   \
+    __vasr_result;                                                                                    \
+})
+
+/**
+ * @brief Reorders the given vector such that each position holds the element
+ * previously stored at the index given for that position.
+ *
+ * Applied to the indices returned by @c vector_argsort , the vector is sorted.
+ * Every element is moved once, no memory is allocated. The indices need to be
+ * a permutation of the positions of the vector, they are modified during the
+ * reordering and restored afterwards.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param indicesPtr the pointer to the vector of indices
+ */
+#define vector_apply_permutation(vectorPtr, indicesPtr)                        \
+do {                                                                           \
+    __DC4C_TYPEOF((vectorPtr))  __v_vap = (vectorPtr);                         \
+    __DC4C_TYPEOF((indicesPtr)) __i_vap = (indicesPtr);                        \
+                                                                               \
+    __dc4c_vector_permute(__v_vap->content, __i_vap->content, __v_vap->count); \
+} while (0)
+
+/**
+ * @brief Sorts the given vector of keys, reordering the given vector of values
+ * alongside.
+ *
+ * The value at each position belongs to the key at the same position, both
+ * vectors need to hold the same amount of elements. The sort is stable, every
+ * key and every value is moved once. The comparison function is called
+ * directly with pointers to the keys. If the vectors differ in size or the
+ * allocation failed, both vectors are left unchanged.
+ *
+ * @param keysPtr the pointer to the vector of keys
+ * @param valuesPtr the pointer to the vector of values
+ * @param comp the comparison function
+ * @return whether the vectors were sorted, @c false if they differ in size
+ *         or the allocation failed
+ */
+#define vector_sort_by_key(keysPtr, valuesPtr, comp) ({                                              \
+    __DC4C_TYPEOF((keysPtr))   __k_vsbk = (keysPtr);                                                 \
+    __DC4C_TYPEOF((valuesPtr)) __v_vsbk = (valuesPtr);                                               \
+                                                                                                     \
+    const size_t __n_vsbk      = __k_vsbk->count;                                                    \
+    bool         __vsbk_result = __v_vsbk->count == __n_vsbk;                                        \
+    if (__vsbk_result && __n_vsbk > 1) {                                                             \
+        size_t* __i_vsbk = (size_t*) malloc(2 * __n_vsbk * sizeof(size_t));                          \
+        if (__i_vsbk != NULL) {                                                                      \
+            __dc4c_vector_argsort(__i_vsbk, __i_vsbk + __n_vsbk, __k_vsbk->content, __n_vsbk, comp); \
+            __dc4c_vector_permute(__k_vsbk->content, __i_vsbk, __n_vsbk);                            \
+            __dc4c_vector_permute(__v_vsbk->content, __i_vsbk, __n_vsbk);                            \
+            free(__i_vsbk);                                                                          \
+        } else {                                                                                     \
+            __vsbk_result = false;                                                                   \
+        }                                                                                            \
+    }                                                                                                \
+    __vsbk_result;                                                                                   \
+})
+
 /**
  * @brief Destroys the given vector.
  *
@@ -294,9 +1067,12 @@ do {                                                       \
  *
  * @param vectorPtr the pointer to the vector
  */
-#define vector_destroy(vectorPtr) \
-do {                              \
-    free((vectorPtr)->content);   \
+#define vector_destroy(vectorPtr)                    \
+do {                                                 \
+    __DC4C_TYPEOF((vectorPtr)) __v_vd = (vectorPtr); \
+                                                     \
+    __dc4c_vector_stats_destroy(__v_vd);             \
+    free(__v_vd->content);                           \
 } while (0)
 
 /**
@@ -348,7 +1124,7 @@ do {                                                  \
 } while (0)
 
 /** The initial values for a vector. */
-#define vector_initializer { 0, 0, NULL }
+#define vector_initializer { 0, 0, NULL __dc4c_vector_stats_initializer }
 
 /**
  * Copies the given vector into the given vector.
@@ -365,6 +1141,8 @@ do {                                                               \
     vector_reserve(__v_l_vc, __v_r_vc->cap);                       \
     memcpy(__v_l_vc->content, __v_r_vc->content,                   \
            __v_r_vc->count * sizeof(*__v_l_vc->content));          \
+    __dc4c_vector_stats_copy(__v_l_vc, __v_r_vc->count             \
+                             * sizeof(*__v_l_vc->content));        \
     __v_l_vc->count = __v_r_vc->count;                             \
 } while (0)
 
@@ -377,13 +1155,17 @@ do {                                                               \
 #endif
 
 /**
- * Defines a vector of the given name and containing the given type.
+ * @brief Defines a vector of the given name and containing the given type.
+ *
+ * If @c DC4C_VECTOR_STATS is defined, the allocation statistics of the vector
+ * type are registered under the given name.
  *
  * @param name the name of the vector
  * @param type the contained type
  */
 #define typedef_vector_named(name, type)        \
 __dc4c_vector_named(name, type);                \
+__dc4c_vector_stats_register(name, type)        \
 __dc4c_vector_cxx_wrapper(name, vector_##name); \
 typedef struct vector_##name vector_##name##_t
 
@@ -46,6 +46,10 @@
 # include <functional>
 # include <vector>
 
+# if __cplusplus >= 202002L
+#  include <ranges>
+# endif
+
 namespace dc4c {
 # if __cplusplus >= 202002L
 template<typename T>
@@ -359,13 +363,128 @@ public:
     __DC4C_CONSTEXPR_SINCE_CXX20 inline void sort(const C& comp = C()) {
         std::sort(begin(), end(), comp);
     }
+
+    /**
+     * Sorts the given amount of the smallest elements into the beginning of
+     * the vector.
+     *
+     * @tparam C the comparator type
+     * @param k the amount of elements to be sorted
+     * @param comp the comparator functor
+     */
+    template<typename C = std::less<value_type>>
+    __DC4C_CONSTEXPR_SINCE_CXX20 inline void partial_sort(size_type k, const C& comp = C()) {
+        std::partial_sort(begin(), begin() + std::min(k, size()), end(), comp);
+    }
+
+    /**
+     * Partially sorts the vector such that the element at the given position
+     * is the one that would be there if the vector was sorted.
+     *
+     * @tparam C the comparator type
+     * @param position the position of the element to be put into place
+     * @param comp the comparator functor
+     */
+    template<typename C = std::less<value_type>>
+    __DC4C_CONSTEXPR_SINCE_CXX20 inline void nth_element(size_type position, const C& comp = C()) {
+        if (position < size()) {
+            std::nth_element(begin(), begin() + position, end(), comp);
+        }
+    }
+
+    /**
+     * @brief Returns the positions of the elements sorted by the elements.
+     *
+     * The sort is stable and moves only the positions, the elements are left
+     * in place.
+     *
+     * @tparam C the comparator type
+     * @param comp the comparator functor
+     * @return the positions of the elements in sorted order
+     */
+    template<typename C = std::less<value_type>>
+    __DC4C_CONSTEXPR_SINCE_CXX20 inline auto argsort(const C& comp = C()) const -> std::vector<size_type> {
+        auto toReturn = std::vector<size_type>(size());
+        for (size_type i = 0; i < toReturn.size(); ++i) {
+            toReturn[i] = i;
+        }
+        std::stable_sort(toReturn.begin(), toReturn.end(), [this, &comp](size_type lhs, size_type rhs) {
+            return comp((*this)[lhs], (*this)[rhs]);
+        });
+        return toReturn;
+    }
+
+    /**
+     * @brief Reorders this vector such that each position holds the element
+     * previously stored at the position given for it.
+     *
+     * Every element is moved once, no memory is allocated. The positions need
+     * to be a permutation, they are modified during the reordering and restored
+     * afterwards.
+     *
+     * @param positions the permutation, as returned by @c argsort
+     */
+    __DC4C_CONSTEXPR_SINCE_CXX20 inline void apply_permutation(std::vector<size_type>& positions) noexcept {
+        __dc4c_vector_permute(underlying.content, positions.data(), size());
+    }
+
+    /**
+     * @brief Offers the given value to this vector keeping the given amount of
+     * greatest values seen so far.
+     *
+     * The vector is used as a bounded heap, use @c top_k_sort to sort the kept
+     * values afterwards.
+     *
+     * @tparam C the comparator type
+     * @param value the offered value
+     * @param k the amount of greatest values to be kept
+     * @param comp the comparator functor
+     * @throw std::bad_alloc if the allocation failed
+     */
+    template<typename C = std::less<value_type>>
+    __DC4C_CONSTEXPR_SINCE_CXX20 inline void top_k(const value_type& value, size_type k, const C& comp = C()) {
+        const auto greater = [&comp](const value_type& lhs, const value_type& rhs) { return comp(rhs, lhs); };
+        if (size() < k) {
+            push_back(value);
+            std::push_heap(begin(), end(), greater);
+        } else if (k > 0 && comp(*begin(), value)) {
+            std::pop_heap(begin(), end(), greater);
+            *(end() - 1) = value;
+            std::push_heap(begin(), end(), greater);
+        }
+    }
+
+    /**
+     * Sorts the values collected by @c top_k in descending order.
+     *
+     * @tparam C the comparator type
+     * @param comp the comparator functor
+     */
+    template<typename C = std::less<value_type>>
+    __DC4C_CONSTEXPR_SINCE_CXX20 inline void top_k_sort(const C& comp = C()) {
+        std::sort_heap(begin(), end(), [&comp](const value_type& lhs, const value_type& rhs) {
+            return comp(rhs, lhs);
+        });
+    }
 };
 }
 
+# if __cplusplus >= 202002L
+#  define __dc4c_vector_cxx_ranges(name)                                  \
+static_assert(std::ranges::contiguous_range<dc4c::vector_##name>          \
+              && std::ranges::sized_range<dc4c::vector_##name>,           \
+              "The DC4C vector needs to be a contiguous and sized range")
+# else
+#  define __dc4c_vector_cxx_ranges(name)
+# endif
+
 #define __dc4c_vector_cxx_wrapper(name, actual) \
 namespace dc4c {                         \
 using vector_##name = vector<actual>;    \
-}
+}                                        \
+__dc4c_vector_cxx_ranges(name)
+
+# include "vector_pipeline.hpp"
 
 # endif /* __DC4C_vector_hpp */
 #endif /* !__DC4C_vector_h */
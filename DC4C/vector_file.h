@@ -0,0 +1,431 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_vector_file_h
+#define __DC4C_vector_file_h
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vector.h"
+
+/** The magic bytes identifying a DC4C vector file. */
+#define __DC4C_VECTOR_FILE_MAGIC "DC4CVEC"
+/** The version of the file format.                 */
+#define __DC4C_VECTOR_FILE_VERSION 1
+/** The byte order mark, stored in native order.    */
+#define __DC4C_VECTOR_FILE_BYTE_ORDER 0x01020304u
+/** The initial state of the checksum.              */
+#define __DC4C_VECTOR_FILE_CHECKSUM_SEED UINT64_C(0xcbf29ce484222325)
+
+/**
+ * @brief The header of a DC4C vector file.
+ *
+ * It is followed by the raw elements. Its size keeps the elements aligned to
+ * 64 bytes inside of the mapped file.
+ */
+struct __dc4c_vector_file_header {
+    /** The magic bytes.                          */
+    char     magic[8];
+    /** The version of the file format.           */
+    uint32_t version;
+    /** The byte order mark.                      */
+    uint32_t byteOrder;
+    /** The size of one element.                  */
+    uint64_t elementSize;
+    /** The amount of elements.                   */
+    uint64_t count;
+    /** The tag identifying the type of elements. */
+    uint64_t typeTag;
+    /** The checksum of the elements.             */
+    uint64_t checksum;
+    /** Reserved for future use, zero.            */
+    uint64_t reserved[2];
+};
+
+/**
+ * @brief Feeds the given bytes into the given checksum state.
+ *
+ * The bytes are hashed eight at a time. The checksum may be calculated
+ * piecewise as long as all pieces but the last one consist of a multiple of
+ * eight bytes.
+ *
+ * @param state the current state of the checksum
+ * @param data the bytes
+ * @param size the amount of bytes
+ * @return the new state of the checksum
+ */
+static inline uint64_t __dc4c_vector_file_checksum_update(uint64_t state, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*) data;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        state = (state ^ word) * UINT64_C(0x100000001b3);
+        state ^= state >> 29;
+    }
+    for (; i < size; ++i) {
+        state = (state ^ bytes[i]) * UINT64_C(0x100000001b3);
+    }
+    return state;
+}
+
+/**
+ * @brief Calculates the checksum of the given bytes.
+ *
+ * The checksum is not cryptographically secure.
+ *
+ * @param data the bytes
+ * @param size the amount of bytes
+ * @return the checksum
+ */
+static inline uint64_t __dc4c_vector_file_checksum(const void* data, size_t size) {
+    return __dc4c_vector_file_checksum_update(__DC4C_VECTOR_FILE_CHECKSUM_SEED, data, size) ^ size;
+}
+
+/**
+ * Writes the given bytes to the given file descriptor.
+ *
+ * @param fd the file descriptor
+ * @param data the bytes to be written
+ * @param size the amount of bytes
+ * @return whether all bytes were written
+ */
+static inline bool __dc4c_vector_file_write(int fd, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*) data;
+    while (size > 0) {
+        const ssize_t written = write(fd, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += written;
+        size  -= (size_t) written;
+    }
+    return true;
+}
+
+/**
+ * @brief Creates a new temporary file next to the file at the given path.
+ *
+ * The temporary file is named after the given path followed by a unique
+ * suffix, so that concurrent writers of the same path do not interfere.
+ *
+ * @param path the path of the final file
+ * @param tmpPath the pointer receiving the allocated path of the temporary file
+ * @return the file descriptor of the temporary file or @c -1 , @c errno is set then
+ */
+static inline int __dc4c_vector_file_create_temporary(const char* path, char** tmpPath) {
+    const size_t pathLength = strlen(path);
+    *tmpPath = (char*) malloc(pathLength + 8);
+    if (*tmpPath == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+    memcpy(*tmpPath, path, pathLength);
+    memcpy(*tmpPath + pathLength, ".XXXXXX", 8);
+
+    const int fd = mkstemp(*tmpPath);
+    if (fd < 0 || fchmod(fd, 0644) != 0) {
+        const int error = errno;
+        if (fd >= 0) {
+            close(fd);
+            unlink(*tmpPath);
+        }
+        free(*tmpPath);
+        *tmpPath = NULL;
+        errno = error;
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Synchronizes the directory containing the file at the given path.
+ *
+ * This makes a preceding rename durable. Errors are ignored, as not every
+ * file system supports synchronizing directories.
+ *
+ * @param path the path of the file
+ */
+static inline void __dc4c_vector_file_sync_directory(const char* path) {
+    const char* slash = strrchr(path, '/');
+
+    int fd;
+    if (slash == NULL) {
+        fd = open(".", O_RDONLY);
+    } else if (slash == path) {
+        fd = open("/", O_RDONLY);
+    } else {
+        char* directory = (char*) malloc((size_t) (slash - path) + 1);
+        if (directory == NULL) return;
+        memcpy(directory, path, (size_t) (slash - path));
+        directory[slash - path] = '\0';
+        fd = open(directory, O_RDONLY);
+        free(directory);
+    }
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+/**
+ * @brief Replaces the file at the given path by the given temporary file.
+ *
+ * The temporary file is synchronized to disk and closed before it is renamed,
+ * so that the file at the given path is either the old or the complete new
+ * one, even after a crash. If the given file was not written successfully
+ * or replacing fails, the temporary file is removed.
+ *
+ * @param fd the file descriptor of the temporary file, closed by this function
+ * @param tmpPath the path of the temporary file
+ * @param path the path of the file to be replaced
+ * @param written whether the temporary file was written successfully
+ * @return whether the file was replaced, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_file_replace(int fd, const char* tmpPath, const char* path, bool written) {
+    bool toReturn = written && fsync(fd) == 0;
+    toReturn = close(fd) == 0 && toReturn;
+    if (toReturn) {
+        toReturn = rename(tmpPath, path) == 0;
+    }
+    if (toReturn) {
+        __dc4c_vector_file_sync_directory(path);
+    } else {
+        const int error = errno;
+        unlink(tmpPath);
+        errno = error;
+    }
+    return toReturn;
+}
+
+/**
+ * @brief Saves the given elements into the file at the given path.
+ *
+ * The file is written under a unique temporary name first, synchronized to
+ * disk and renamed afterwards, so an existing file is replaced atomically.
+ *
+ * @param path the path of the file
+ * @param content the elements
+ * @param elementSize the size of one element
+ * @param count the amount of elements
+ * @param typeTag the tag identifying the type of the elements
+ * @return whether the file was written successfully, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_save(const char* path,
+                                      const void* content,
+                                      size_t      elementSize,
+                                      size_t      count,
+                                      uint64_t    typeTag) {
+    struct __dc4c_vector_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, __DC4C_VECTOR_FILE_MAGIC, sizeof(__DC4C_VECTOR_FILE_MAGIC));
+    header.version     = __DC4C_VECTOR_FILE_VERSION;
+    header.byteOrder   = __DC4C_VECTOR_FILE_BYTE_ORDER;
+    header.elementSize = elementSize;
+    header.count       = count;
+    header.typeTag     = typeTag;
+    header.checksum    = __dc4c_vector_file_checksum(content, elementSize * count);
+
+    char* tmpPath;
+    const int fd = __dc4c_vector_file_create_temporary(path, &tmpPath);
+    if (fd < 0) {
+        return false;
+    }
+    const bool written = __dc4c_vector_file_write(fd, &header, sizeof(header))
+                      && __dc4c_vector_file_write(fd, content, elementSize * count);
+    const bool toReturn = __dc4c_vector_file_replace(fd, tmpPath, path, written);
+    free(tmpPath);
+    return toReturn;
+}
+
+/**
+ * @brief Validates the given header of a file of the given size.
+ *
+ * The amount of elements is derived from the size of the file by division,
+ * so that crafted headers cannot make it overflow.
+ *
+ * @param header the header
+ * @param fileSize the size of the whole file in bytes
+ * @param elementSize the expected size of one element
+ * @param typeTag the expected type tag
+ * @return whether the header describes the file and matches the expectations
+ */
+static inline bool __dc4c_vector_file_header_valid(const struct __dc4c_vector_file_header* header,
+                                                   uint64_t                                fileSize,
+                                                   size_t                                  elementSize,
+                                                   uint64_t                                typeTag) {
+    if (memcmp(header->magic, __DC4C_VECTOR_FILE_MAGIC, sizeof(__DC4C_VECTOR_FILE_MAGIC)) != 0
+        || header->version     != __DC4C_VECTOR_FILE_VERSION
+        || header->byteOrder   != __DC4C_VECTOR_FILE_BYTE_ORDER
+        || header->elementSize == 0
+        || header->elementSize != elementSize
+        || header->typeTag     != typeTag
+        || fileSize < sizeof(*header)) {
+        return false;
+    }
+    const uint64_t bytes = fileSize - sizeof(*header);
+    return bytes % header->elementSize == 0 && header->count == bytes / header->elementSize;
+}
+
+/**
+ * @brief Maps the file at the given path read-only into memory.
+ *
+ * The header of the file is validated against the given element size and
+ * type tag; the elements themselves are not read.
+ *
+ * @param path the path of the file
+ * @param elementSize the expected size of one element
+ * @param typeTag the expected type tag
+ * @param content the pointer receiving the address of the mapped elements
+ * @param count the pointer receiving the amount of mapped elements
+ * @return whether the file was mapped successfully, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_map(const char* path,
+                                     size_t      elementSize,
+                                     uint64_t    typeTag,
+                                     void**      content,
+                                     size_t*     count) {
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+    if ((size_t) info.st_size < sizeof(struct __dc4c_vector_file_header)) {
+        close(fd);
+        errno = EINVAL;
+        return false;
+    }
+    void* base = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    const struct __dc4c_vector_file_header* header = (const struct __dc4c_vector_file_header*) base;
+    if (!__dc4c_vector_file_header_valid(header, (uint64_t) info.st_size, elementSize, typeTag)) {
+        munmap(base, (size_t) info.st_size);
+        errno = EINVAL;
+        return false;
+    }
+    *content = (unsigned char*) base + sizeof(*header);
+    *count   = (size_t) header->count;
+    return true;
+}
+
+/**
+ * Returns the header of the mapped elements at the given address.
+ *
+ * @param content the address of the mapped elements
+ * @return the header of the mapped file
+ */
+#define __dc4c_vector_file_header_of(content) \
+    ((const struct __dc4c_vector_file_header*) ((const unsigned char*) (content) - sizeof(struct __dc4c_vector_file_header)))
+
+/**
+ * @brief Saves the content of the given vector into the file at the given path.
+ *
+ * The file consists of a header, holding the size of the elements, their
+ * amount, the given type tag and a checksum, followed by the raw elements. An
+ * existing file is replaced atomically. The elements are saved as they are in
+ * memory, so they should not contain pointers.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param path the path of the file
+ * @param typeTag the tag identifying the type of the elements
+ * @return whether the vector was saved successfully, @c errno is set otherwise
+ */
+#define vector_save(vectorPtr, path, typeTag) ({                            \
+    __DC4C_TYPEOF((vectorPtr)) __v_vsv = (vectorPtr);                       \
+                                                                            \
+    __dc4c_vector_save((path), __v_vsv->content, sizeof(*__v_vsv->content), \
+                       __v_vsv->count, (uint64_t) (typeTag));               \
+})
+
+/**
+ * @brief Maps the file at the given path as read-only view into the given vector.
+ *
+ * The file is mapped in constant time, its pages are loaded lazily when
+ * accessed. The size of the elements and the type tag stored in the file must
+ * match the vector and the given type tag. The vector must not be modified
+ * and must be destroyed using @c vector_unmap . If the file could not be
+ * mapped, the content of the given vector is left unchanged.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param path the path of the file
+ * @param typeTag the expected type tag
+ * @return whether the file was mapped successfully, @c errno is set otherwise
+ */
+#define vector_map(vectorPtr, path, typeTag) ({                                                    \
+    __DC4C_TYPEOF((vectorPtr)) __v_vmp = (vectorPtr);                                              \
+                                                                                                   \
+    void*  __c_vmp;                                                                                \
+    size_t __n_vmp;                                                                                \
+    bool __vmp_result = __dc4c_vector_map((path), sizeof(*__v_vmp->content), (uint64_t) (typeTag), \
+                                          &__c_vmp, &__n_vmp);                                     \
+    if (__vmp_result) {                                                                            \
+        __v_vmp->content = (__DC4C_TYPEOF(__v_vmp->content)) __c_vmp;                              \
+        __v_vmp->count   = __n_vmp;                                                                \
+        __v_vmp->cap     = __n_vmp;                                                                \
+    }                                                                                              \
+    __vmp_result;                                                                                  \
+})
+
+/**
+ * @brief Verifies the checksum of the given vector mapped by @c vector_map .
+ *
+ * All elements are read.
+ *
+ * @param vectorPtr the pointer to the mapped vector
+ * @return whether the checksum matches the elements
+ */
+#define vector_verify(vectorPtr) ({                                                                   \
+    __DC4C_TYPEOF((vectorPtr)) __v_vvf = (vectorPtr);                                                 \
+                                                                                                      \
+    __dc4c_vector_file_header_of(__v_vvf->content)->checksum                                          \
+        == __dc4c_vector_file_checksum(__v_vvf->content, __v_vvf->count * sizeof(*__v_vvf->content)); \
+})
+
+/**
+ * @brief Unmaps the given vector mapped by @c vector_map .
+ *
+ * The vector must be reconstructed before being used again.
+ *
+ * @param vectorPtr the pointer to the mapped vector
+ */
+#define vector_unmap(vectorPtr)                                                                    \
+do {                                                                                               \
+    __DC4C_TYPEOF((vectorPtr)) __v_vum = (vectorPtr);                                              \
+                                                                                                   \
+    munmap((void*) __dc4c_vector_file_header_of(__v_vum->content),                                 \
+           sizeof(struct __dc4c_vector_file_header) + __v_vum->count * sizeof(*__v_vum->content)); \
+} while (0)
+
+#ifdef __cplusplus
+# include "vector_file.hpp"
+#endif
+
+#endif /* __DC4C_vector_file_h */
@@ -0,0 +1,171 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_vector_file_h
+# warning Wrong inclusion of "vector_file.hpp" redirected to #include "vector_file.h"!
+# include "vector_file.h"
+#else
+# ifndef __DC4C_vector_file_hpp
+# define __DC4C_vector_file_hpp
+
+# include <cstdint>
+# include <system_error>
+
+namespace dc4c {
+/**
+ * Saves the given vector into the file at the given path.
+ *
+ * @tparam T the C DC4C vector type
+ * @param self the vector to be saved
+ * @param path the path of the file
+ * @param typeTag the tag identifying the type of the elements
+ * @throw std::system_error if the file could not be written
+ */
+template<typename T>
+inline void save(const vector<T>& self, const char* path, std::uint64_t typeTag) {
+    if (!vector_save(&self.data(), path, typeTag)) {
+        throw std::system_error(errno, std::generic_category(), path);
+    }
+}
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for a C vector
+ * mapped read-only from a file.
+ *
+ * @tparam T the C DC4C vector type
+ */
+template<typename T>
+class mapped_vector {
+    /** The underlying mapped C vector. */
+    T underlying;
+
+public:
+    /** The type used for the size of the vector. */
+    using size_type = typename std::decay<decltype(underlying.count)>::type;
+    /** The type stored in the underlying vector. */
+    using value_type = typename std::decay<decltype(*underlying.content)>::type;
+
+    /**
+     * Maps the file at the given path.
+     *
+     * @param path the path of the file
+     * @param typeTag the expected type tag
+     * @throw std::system_error if the file could not be mapped
+     */
+    inline mapped_vector(const char* path, std::uint64_t typeTag): underlying(vector_initializer) {
+        if (!vector_map(&underlying, path, typeTag)) {
+            throw std::system_error(errno, std::generic_category(), path);
+        }
+    }
+
+    mapped_vector(const mapped_vector&) = delete;
+
+    inline mapped_vector(mapped_vector&& other) noexcept: underlying(other.underlying) {
+        vector_init(&other.underlying);
+    }
+
+    inline ~mapped_vector() {
+        if (underlying.content != nullptr) {
+            vector_unmap(&underlying);
+        }
+    }
+
+    auto operator=(const mapped_vector&) -> mapped_vector& = delete;
+
+    inline auto operator=(mapped_vector&& other) noexcept -> mapped_vector& {
+        if (underlying.content != nullptr) {
+            vector_unmap(&underlying);
+        }
+        underlying = other.underlying;
+        vector_init(&other.underlying);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the underlying mapped C vector.
+     *
+     * The returned vector must not be modified.
+     *
+     * @return the underlying C vector
+     */
+    constexpr inline auto data() const -> const T& {
+        return underlying;
+    }
+
+    /**
+     * Copies the mapped elements into a DC4C wrapper vector.
+     *
+     * @return the copied vector
+     */
+    inline operator vector<T>() const {
+        return vector<T>(&underlying);
+    }
+
+    /**
+     * Verifies the checksum of the mapped elements.
+     *
+     * @return whether the checksum matches
+     */
+    inline auto verify() const -> bool {
+        return vector_verify(&underlying);
+    }
+
+    /**
+     * @brief Returns the element at the given position.
+     *
+     * The position is not range checked.
+     *
+     * @param position the position
+     * @return the element at the given position
+     */
+    constexpr inline auto operator[](size_type position) const noexcept -> const value_type& {
+        return underlying.content[position];
+    }
+
+    /**
+     * Returns an iterator to the first mapped element.
+     *
+     * @return a pointer to the first mapped element
+     */
+    constexpr inline auto begin() const noexcept -> const value_type* {
+        return underlying.content;
+    }
+
+    /**
+     * Returns a past the end iterator.
+     *
+     * @return a pointer past the last mapped element
+     */
+    constexpr inline auto end() const noexcept -> const value_type* {
+        return underlying.content + underlying.count;
+    }
+
+    /**
+     * Returns the amount of mapped elements.
+     *
+     * @return the amount of mapped elements
+     */
+    constexpr inline auto size() const noexcept -> size_type {
+        return underlying.count;
+    }
+};
+}
+
+# endif /* __DC4C_vector_file_hpp */
+#endif /* !__DC4C_vector_file_h */
@@ -0,0 +1,510 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_vector_h
+# warning Wrong inclusion of "vector_pipeline.hpp" redirected to #include "vector.h"!
+# include "vector.h"
+#else
+# ifndef __DC4C_vector_pipeline_hpp
+# define __DC4C_vector_pipeline_hpp
+
+# include <cstddef>
+# include <functional>
+# include <type_traits>
+# include <utility>
+
+namespace dc4c {
+/**
+ * @brief A stage of a pipeline applying the given function to each element.
+ *
+ * @tparam F the type of the function
+ */
+template<typename F>
+struct map_stage {
+    /** The applied function. */
+    F function;
+
+    /**
+     * The consumer applying the function before passing the result on.
+     *
+     * @tparam Next the type of the following consumer
+     */
+    template<typename Next>
+    struct consumer {
+        /** The applied function.     */
+        F function;
+        /** The following consumer.   */
+        Next next;
+
+        template<typename V>
+        inline auto operator()(V&& value) -> bool {
+            return next(function(std::forward<V>(value)));
+        }
+    };
+
+    /**
+     * Returns the consumer of this stage passing its results to the given consumer.
+     *
+     * @param next the following consumer
+     * @return the consumer of this stage
+     */
+    template<typename Next>
+    inline auto wrap(Next next) const -> consumer<Next> {
+        return consumer<Next> { function, std::move(next) };
+    }
+
+    /**
+     * Returns the maximum amount of elements produced from the given amount of elements.
+     *
+     * @param count the amount of consumed elements
+     * @return the maximum amount of produced elements
+     */
+    constexpr inline auto bound(std::size_t count) const noexcept -> std::size_t {
+        return count;
+    }
+};
+
+/**
+ * @brief A stage of a pipeline passing on the elements satisfying the given predicate.
+ *
+ * @tparam P the type of the predicate
+ */
+template<typename P>
+struct filter_stage {
+    /** The predicate. */
+    P predicate;
+
+    /**
+     * The consumer passing on the elements satisfying the predicate.
+     *
+     * @tparam Next the type of the following consumer
+     */
+    template<typename Next>
+    struct consumer {
+        /** The predicate.            */
+        P predicate;
+        /** The following consumer.   */
+        Next next;
+
+        template<typename V>
+        inline auto operator()(V&& value) -> bool {
+            if (!predicate(static_cast<const typename std::decay<V>::type&>(value))) {
+                return true;
+            }
+            return next(std::forward<V>(value));
+        }
+    };
+
+    /**
+     * Returns the consumer of this stage passing its results to the given consumer.
+     *
+     * @param next the following consumer
+     * @return the consumer of this stage
+     */
+    template<typename Next>
+    inline auto wrap(Next next) const -> consumer<Next> {
+        return consumer<Next> { predicate, std::move(next) };
+    }
+
+    /**
+     * Returns the maximum amount of elements produced from the given amount of elements.
+     *
+     * @param count the amount of consumed elements
+     * @return the maximum amount of produced elements
+     */
+    constexpr inline auto bound(std::size_t count) const noexcept -> std::size_t {
+        return count;
+    }
+};
+
+/**
+ * A stage of a pipeline passing on the given amount of elements and stopping the pipeline afterwards.
+ */
+struct take_stage {
+    /** The amount of passed elements. */
+    std::size_t count;
+
+    /**
+     * The consumer passing on the first elements.
+     *
+     * @tparam Next the type of the following consumer
+     */
+    template<typename Next>
+    struct consumer {
+        /** The amount of elements still to be passed on. */
+        std::size_t remaining;
+        /** The following consumer.                       */
+        Next next;
+
+        template<typename V>
+        inline auto operator()(V&& value) -> bool {
+            if (remaining == 0) {
+                return false;
+            }
+            --remaining;
+            return next(std::forward<V>(value)) && remaining > 0;
+        }
+    };
+
+    /**
+     * Returns the consumer of this stage passing its results to the given consumer.
+     *
+     * @param next the following consumer
+     * @return the consumer of this stage
+     */
+    template<typename Next>
+    inline auto wrap(Next next) const -> consumer<Next> {
+        return consumer<Next> { count, std::move(next) };
+    }
+
+    /**
+     * Returns the maximum amount of elements produced from the given amount of elements.
+     *
+     * @param consumed the amount of consumed elements
+     * @return the maximum amount of produced elements
+     */
+    constexpr inline auto bound(std::size_t consumed) const noexcept -> std::size_t {
+        return consumed < count ? consumed : count;
+    }
+};
+
+/**
+ * @brief A stage of a pipeline consisting of two stages.
+ *
+ * @tparam A the type of the first stage
+ * @tparam B the type of the second stage
+ */
+template<typename A, typename B>
+struct chain_stage {
+    /** The first stage.  */
+    A first;
+    /** The second stage. */
+    B second;
+
+    /**
+     * Returns the consumer of the first stage passing its results to the second stage.
+     *
+     * @param next the consumer following the second stage
+     * @return the consumer of this stage
+     */
+    template<typename Next>
+    inline auto wrap(Next next) const -> decltype(std::declval<const A&>().wrap(std::declval<const B&>().wrap(next))) {
+        return first.wrap(second.wrap(std::move(next)));
+    }
+
+    /**
+     * Returns the maximum amount of elements produced from the given amount of elements.
+     *
+     * @param count the amount of consumed elements
+     * @return the maximum amount of produced elements
+     */
+    constexpr inline auto bound(std::size_t count) const noexcept -> std::size_t {
+        return second.bound(first.bound(count));
+    }
+};
+
+/**
+ * Indicates whether the given type is a stage of a pipeline.
+ *
+ * @tparam S the type to be checked
+ */
+template<typename S>
+struct is_pipeline_stage: std::false_type {};
+
+template<typename F>
+struct is_pipeline_stage<map_stage<F>>: std::true_type {};
+
+template<typename P>
+struct is_pipeline_stage<filter_stage<P>>: std::true_type {};
+
+template<>
+struct is_pipeline_stage<take_stage>: std::true_type {};
+
+template<typename A, typename B>
+struct is_pipeline_stage<chain_stage<A, B>>: std::true_type {};
+
+/**
+ * @brief This class represents a lazy pipeline over the elements of a DC4C vector.
+ *
+ * Nothing is evaluated until the pipeline is consumed by a sink, which
+ * traverses the vector once, passing each element through all stages.
+ * The pipeline refers to the elements of the vector, which therefore needs to
+ * outlive the pipeline.
+ *
+ * @tparam T the type of the elements of the vector
+ * @tparam S the type of the stage
+ */
+template<typename T, typename S>
+class pipeline {
+    /** The first element.          */
+    const T* first;
+    /** The past the end element.   */
+    const T* last;
+    /** The stage of this pipeline. */
+    S stage;
+
+    /**
+     * The consumer passing the results of a pipeline to a function.
+     *
+     * @tparam F the type of the function
+     */
+    template<typename F>
+    struct sink {
+        /** The function. */
+        F& function;
+
+        template<typename V>
+        inline auto operator()(V&& value) -> bool {
+            function(std::forward<V>(value));
+            return true;
+        }
+    };
+
+public:
+    /**
+     * Constructs a pipeline over the given elements.
+     *
+     * @param first the first element
+     * @param last the past the end element
+     * @param stage the stage
+     */
+    constexpr inline pipeline(const T* first, const T* last, S stage): first(first), last(last), stage(std::move(stage)) {}
+
+    /**
+     * Returns the stage of this pipeline.
+     *
+     * @return the stage
+     */
+    constexpr inline auto getStage() const noexcept -> const S& {
+        return stage;
+    }
+
+    /**
+     * Returns the first element consumed by this pipeline.
+     *
+     * @return the first element
+     */
+    constexpr inline auto begin() const noexcept -> const T* {
+        return first;
+    }
+
+    /**
+     * Returns the past the end element consumed by this pipeline.
+     *
+     * @return the past the end element
+     */
+    constexpr inline auto end() const noexcept -> const T* {
+        return last;
+    }
+
+    /**
+     * Returns the maximum amount of elements produced by this pipeline.
+     *
+     * @return the maximum amount of produced elements
+     */
+    constexpr inline auto size_bound() const noexcept -> std::size_t {
+        return stage.bound(static_cast<std::size_t>(last - first));
+    }
+
+    /**
+     * Evaluates this pipeline, calling the given function with each produced element.
+     *
+     * @tparam F the type of the function
+     * @param function the function
+     */
+    template<typename F>
+    inline void for_each(F function) const {
+        if (size_bound() == 0) return;
+
+        auto consumer = stage.wrap(sink<F> { function });
+        for (const T* it = first; it != last && consumer(*it); ++it);
+    }
+};
+
+/**
+ * A sink appending the results of a pipeline to a DC4C vector.
+ *
+ * @tparam V the type of the DC4C vector
+ */
+template<typename V>
+struct into_sink {
+    /** The vector to append to. */
+    V& target;
+};
+
+/**
+ * A sink collecting the results of a pipeline into a new DC4C vector.
+ *
+ * @tparam V the type of the DC4C vector
+ */
+template<typename V>
+struct collect_sink {};
+
+/**
+ * Creates a stage applying the given function to each element.
+ *
+ * @param function the function
+ * @return the stage
+ */
+template<typename F>
+constexpr inline auto map(F function) -> map_stage<F> {
+    return map_stage<F> { std::move(function) };
+}
+
+/**
+ * Creates a stage passing on the elements satisfying the given predicate.
+ *
+ * @param predicate the predicate
+ * @return the stage
+ */
+template<typename P>
+constexpr inline auto filter(P predicate) -> filter_stage<P> {
+    return filter_stage<P> { std::move(predicate) };
+}
+
+/**
+ * Creates a stage passing on the given amount of elements.
+ *
+ * @param count the amount of passed elements
+ * @return the stage
+ */
+constexpr inline auto take(std::size_t count) -> take_stage {
+    return take_stage { count };
+}
+
+/**
+ * @brief Creates a sink appending the results of a pipeline to the given vector.
+ *
+ * The vector is grown once to hold the maximum amount of results. It may be
+ * the source of the pipeline.
+ *
+ * @param target the vector to append to
+ * @return the sink
+ */
+template<typename T>
+constexpr inline auto into(vector<T>& target) -> into_sink<vector<T>> {
+    return into_sink<vector<T>> { target };
+}
+
+/**
+ * @brief Creates a sink collecting the results of a pipeline into a new vector
+ * of the given type.
+ *
+ * The vector is allocated once to hold the maximum amount of results.
+ *
+ * @tparam V the type of the DC4C vector
+ * @return the sink
+ */
+template<typename V>
+constexpr inline auto collect() -> collect_sink<V> {
+    return collect_sink<V>();
+}
+
+/**
+ * Composes the given stages.
+ *
+ * @param first the first stage
+ * @param second the second stage
+ * @return the composed stage
+ */
+template<typename A, typename B, typename = typename std::enable_if<is_pipeline_stage<A>::value
+                                                                   && is_pipeline_stage<B>::value>::type>
+constexpr inline auto operator|(A first, B second) -> chain_stage<A, B> {
+    return chain_stage<A, B> { std::move(first), std::move(second) };
+}
+
+/**
+ * Creates a lazy pipeline over the elements of the given vector.
+ *
+ * @param source the vector
+ * @param stage the first stage
+ * @return the pipeline
+ */
+template<typename T, typename S, typename = typename std::enable_if<is_pipeline_stage<S>::value>::type>
+constexpr inline auto operator|(const vector<T>& source, S stage) -> pipeline<typename vector<T>::value_type, S> {
+    return pipeline<typename vector<T>::value_type, S>(source.begin(), source.end(), std::move(stage));
+}
+
+/** Pipelines over temporary vectors would refer to destroyed elements. */
+template<typename T, typename S, typename = typename std::enable_if<is_pipeline_stage<S>::value>::type>
+auto operator|(vector<T>&& source, S stage) -> pipeline<typename vector<T>::value_type, S> = delete;
+
+/**
+ * Appends the given stage to the given pipeline.
+ *
+ * @param source the pipeline
+ * @param stage the appended stage
+ * @return the extended pipeline
+ */
+template<typename T, typename S, typename N, typename = typename std::enable_if<is_pipeline_stage<N>::value>::type>
+constexpr inline auto operator|(const pipeline<T, S>& source, N stage) -> pipeline<T, chain_stage<S, N>> {
+    return pipeline<T, chain_stage<S, N>>(source.begin(), source.end(),
+                                          chain_stage<S, N> { source.getStage(), std::move(stage) });
+}
+
+/**
+ * @brief Evaluates the given pipeline, appending its results to the vector of the given sink.
+ *
+ * If the vector of the sink is the source of the pipeline, the results are
+ * collected into a temporary vector first and appended afterwards, as growing
+ * the vector would invalidate the elements the pipeline refers to.
+ *
+ * @param source the pipeline
+ * @param sink the sink
+ * @return the vector of the sink
+ * @throw std::bad_alloc if the allocation failed
+ */
+template<typename T, typename S, typename V>
+inline auto operator|(const pipeline<T, S>& source, into_sink<V> sink) -> V& {
+    V& target = sink.target;
+
+    const std::less<const void*> before;
+    if (before(target.begin(), source.end()) && before(source.begin(), target.end())) {
+        V results;
+        source | into(results);
+        target.reserve(target.size() + results.size());
+        for (const auto& value : results) {
+            target.push_back(value);
+        }
+        return target;
+    }
+    target.reserve(target.size() + source.size_bound());
+    source.for_each([&target](const typename V::value_type& value) {
+        target.push_back(value);
+    });
+    return target;
+}
+
+/**
+ * Evaluates the given pipeline, collecting its results into a new vector.
+ *
+ * @param source the pipeline
+ * @return the vector holding the results
+ * @throw std::bad_alloc if the allocation failed
+ */
+template<typename T, typename S, typename V>
+inline auto operator|(const pipeline<T, S>& source, collect_sink<V>) -> V {
+    V toReturn;
+    source | into(toReturn);
+    return toReturn;
+}
+}
+
+# endif /* __DC4C_vector_pipeline_hpp */
+#endif /* !__DC4C_vector_h */
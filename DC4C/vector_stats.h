@@ -0,0 +1,409 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_vector_h
+# warning Wrong inclusion of "vector_stats.h" redirected to #include "vector.h"!
+# include "vector.h"
+#else
+# ifndef __DC4C_vector_stats_h
+# define __DC4C_vector_stats_h
+
+# include <stdio.h>
+
+# ifdef __cplusplus
+#  include <type_traits>
+# endif
+
+# ifndef DC4C_VECTOR_STATS_MAX_TYPES
+/** The maximum amount of vector types defined in one translation unit. */
+#  define DC4C_VECTOR_STATS_MAX_TYPES 1024
+# endif
+
+/**
+ * @brief Represents the allocation and growth statistics of one vector type.
+ *
+ * The statistics are shared by all vectors defined with the same name, even
+ * across translation units.
+ */
+struct vector_stats {
+    /** The name of the vector type.                                */
+    const char*          name;
+    /** The size of one element.                                    */
+    size_t               elementSize;
+    /** The amount of reallocations.                                */
+    size_t               reallocations;
+    /** The amount of bytes copied by reallocations and copies.     */
+    size_t               bytesCopied;
+    /** The amount of bytes moved by insertions and erasures.       */
+    size_t               bytesMoved;
+    /** The greatest capacity of a single vector.                   */
+    size_t               peakCapacity;
+    /** The greatest unused capacity of a vector when destroyed.   */
+    size_t               wastedCapacity;
+    /** The statistics of the next vector type.                     */
+    struct vector_stats* next;
+};
+
+/** The statistics of all registered vector types. */
+__attribute__((weak)) struct vector_stats* __dc4c_vector_stats_list;
+
+
+/**
+ * @brief Returns the statistics registered for the given vector type name.
+ *
+ * If no statistics are registered under the given name yet, they are created.
+ *
+ * @param name the name of the vector type
+ * @param elementSize the size of one element
+ * @return the statistics or @c NULL if the allocation failed
+ */
+static inline struct vector_stats* __dc4c_vector_stats_find(const char* name, size_t elementSize) {
+    for (struct vector_stats* it = __dc4c_vector_stats_list; it != NULL; it = it->next) {
+        if (strcmp(it->name, name) == 0) {
+            return it;
+        }
+    }
+    struct vector_stats* toReturn = (struct vector_stats*) calloc(1, sizeof(struct vector_stats));
+    if (toReturn != NULL) {
+        toReturn->name           = name;
+        toReturn->elementSize    = elementSize;
+        toReturn->next           = __dc4c_vector_stats_list;
+        __dc4c_vector_stats_list = toReturn;
+    }
+    return toReturn;
+}
+
+/**
+ * Raises the given counter to the given value if it is smaller.
+ *
+ * @param counter the counter
+ * @param value the value
+ */
+static inline void __dc4c_vector_stats_max(size_t* counter, size_t value) {
+    size_t current = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    while (current < value
+           && !__atomic_compare_exchange_n(counter, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/**
+ * Records a reallocation.
+ *
+ * @param stats the statistics, may be @c NULL
+ * @param copied the amount of bytes copied by the reallocation
+ * @param cap the new capacity
+ */
+static inline void __dc4c_vector_stats_record_grow(struct vector_stats* stats, size_t copied, size_t cap) {
+    if (stats == NULL) return;
+
+    __atomic_fetch_add(&stats->reallocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->bytesCopied, copied, __ATOMIC_RELAXED);
+    __dc4c_vector_stats_max(&stats->peakCapacity, cap);
+}
+
+/**
+ * Records the destruction of a vector.
+ *
+ * @param stats the statistics, may be @c NULL
+ * @param cap the capacity of the vector
+ * @param count the amount of elements in the vector
+ */
+static inline void __dc4c_vector_stats_record_destroy(struct vector_stats* stats, size_t cap, size_t count) {
+    if (stats == NULL) return;
+
+    __dc4c_vector_stats_max(&stats->wastedCapacity, cap - count);
+}
+
+/**
+ * Adds the given amount to the given counter of the given statistics.
+ *
+ * @param stats the statistics, may be @c NULL
+ * @param field the name of the counter
+ * @param amount the amount to be added
+ */
+# define __dc4c_vector_stats_add(stats, field, amount)                                \
+do {                                                                                  \
+    struct vector_stats* __s_vsa = (stats);                                           \
+    if (__s_vsa != NULL) {                                                            \
+        __atomic_fetch_add(&__s_vsa->field, (size_t) (amount), __ATOMIC_RELAXED);     \
+    }                                                                                 \
+} while (0)
+
+# ifdef __cplusplus
+/**
+ * @brief Finds the statistics of the given vector type.
+ *
+ * It is specialized for every vector type defined by @c typedef_vector_named .
+ *
+ * @tparam V the C vector type
+ */
+template<typename V>
+struct __dc4c_vector_stats_accessor {
+    static inline auto get() -> vector_stats* {
+        return nullptr;
+    }
+};
+
+/**
+ * The vector type referred to by the given type.
+ *
+ * @tparam R the reference to the vector type
+ */
+template<typename R>
+using __dc4c_vector_stats_type = typename std::remove_cv<typename std::remove_reference<R>::type>::type;
+
+/** The vector structure does not carry any statistics member in C++. */
+#  define __dc4c_vector_stats_key(name)
+
+/** There is no member to be initialized in C++. */
+#  define __dc4c_vector_stats_initializer
+
+/**
+ * Defines the accessor of the statistics of a vector type and registers them
+ * when the program is started.
+ *
+ * @param name the name of the vector type
+ * @param type the contained type
+ */
+#  define __dc4c_vector_stats_register(name, type)                                        \
+template<>                                                                                \
+struct __dc4c_vector_stats_accessor<struct vector_##name> {                               \
+    static inline auto get() -> vector_stats* {                                           \
+        static vector_stats* const stats = __dc4c_vector_stats_find(#name, sizeof(type)); \
+        return stats;                                                                     \
+    }                                                                                     \
+};                                                                                        \
+__attribute__((constructor)) static void __dc4c_vector_stats_register_##name(void) {      \
+    __dc4c_vector_stats_accessor<struct vector_##name>::get();                            \
+}
+
+/**
+ * Returns the statistics of the type of the given vector.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @return the statistics or @c NULL if the type was not registered
+ */
+#  define __dc4c_vector_stats_of(vectorPtr) \
+    __dc4c_vector_stats_accessor<__dc4c_vector_stats_type<decltype(*(vectorPtr))>>::get()
+# else
+/**
+ * An entry of the statistics of the vector types of this translation unit.
+ */
+struct __dc4c_vector_stats_entry {
+    /** The key of the vector type, zero for an unused entry. */
+    size_t               key;
+    /** The name of the vector type.                          */
+    const char*          name;
+    /** The statistics of the vector type.                    */
+    struct vector_stats* stats;
+};
+
+/** The statistics of the vector types of this translation unit, hashed by their key. */
+__attribute__((unused)) static struct __dc4c_vector_stats_entry __dc4c_vector_stats_table[DC4C_VECTOR_STATS_MAX_TYPES];
+
+/**
+ * @brief Returns the entry of the given key in the statistics of this translation unit.
+ *
+ * @param key the key of the vector type
+ * @return the entry of the key, or an unused entry if it is not registered
+ */
+__attribute__((unused)) static inline struct __dc4c_vector_stats_entry* __dc4c_vector_stats_entry(size_t key) {
+    size_t i = key % DC4C_VECTOR_STATS_MAX_TYPES;
+    for (size_t probes = 0; probes < DC4C_VECTOR_STATS_MAX_TYPES; ++probes) {
+        if (__dc4c_vector_stats_table[i].key == key || __dc4c_vector_stats_table[i].key == 0) {
+            return &__dc4c_vector_stats_table[i];
+        }
+        i = (i + 1) % DC4C_VECTOR_STATS_MAX_TYPES;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Registers the given statistics under the given key in this translation unit.
+ *
+ * If the key is already taken by another vector type, or if there is no room
+ * left, the statistics could not be told apart and the program is aborted.
+ *
+ * @param key the key of the vector type
+ * @param name the name of the vector type
+ * @param stats the statistics
+ */
+__attribute__((unused)) static inline void __dc4c_vector_stats_insert(size_t key,
+                                                                      const char* name,
+                                                                      struct vector_stats* stats) {
+    struct __dc4c_vector_stats_entry* entry = __dc4c_vector_stats_entry(key);
+    if (entry == NULL) {
+        fprintf(stderr, "DC4C: Cannot register the statistics of the vector type \"%s\", more than %d vector "
+                        "types are defined in one translation unit.\n", name, DC4C_VECTOR_STATS_MAX_TYPES);
+        abort();
+    }
+    if (entry->key == 0) {
+        entry->key   = key;
+        entry->name  = name;
+        entry->stats = stats;
+    } else if (strcmp(entry->name, name) != 0) {
+        fprintf(stderr, "DC4C: The statistics of the vector types \"%s\" and \"%s\" cannot be told apart, define "
+                        "them on different lines or give them names of different lengths.\n", entry->name, name);
+        abort();
+    }
+}
+
+/**
+ * @brief Calculates the key of a vector type defined on the current line.
+ *
+ * The key only depends on the line of the definition and on the length of the
+ * name, so that the vector structure is the same in every translation unit.
+ *
+ * @param name the name of the vector type
+ */
+#  define __DC4C_VECTOR_STATS_KEY(name) ((size_t) __LINE__ * 64 + sizeof(#name) % 64)
+
+/**
+ * Declares the member carrying the key of the type of a vector.
+ *
+ * @param name the name of the vector type
+ */
+#  define __dc4c_vector_stats_key(name) char __dc4c_stats_key[0][__DC4C_VECTOR_STATS_KEY(name)];
+
+/** The initializer of the member carrying the key of the type of a vector. */
+#  define __dc4c_vector_stats_initializer , {}
+
+/**
+ * Registers the statistics of a vector type when the program is started.
+ *
+ * @param name the name of the vector type
+ * @param type the contained type
+ */
+#  define __dc4c_vector_stats_register(name, type)                                   \
+__attribute__((constructor)) static void __dc4c_vector_stats_register_##name(void) { \
+    __dc4c_vector_stats_insert(__DC4C_VECTOR_STATS_KEY(name), #name,                 \
+                               __dc4c_vector_stats_find(#name, sizeof(type)));       \
+}
+
+/**
+ * Returns the statistics of the type of the given vector.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @return the statistics or @c NULL if the type was not registered
+ */
+#  define __dc4c_vector_stats_of(vectorPtr) ({                               \
+    struct __dc4c_vector_stats_entry* __e_vso =                              \
+        __dc4c_vector_stats_entry(sizeof((vectorPtr)->__dc4c_stats_key[0])); \
+    __e_vso == NULL ? NULL : __e_vso->stats;                                 \
+})
+# endif
+
+/**
+ * Records the reallocation of the given vector to the given capacity.
+ *
+ * @param vectorPtr the pointer to the vector, still holding its old capacity
+ * @param newCap the new capacity
+ */
+# define __dc4c_vector_stats_grow(vectorPtr, newCap)                                            \
+    __dc4c_vector_stats_record_grow(__dc4c_vector_stats_of(vectorPtr),                          \
+                                    (vectorPtr)->content == NULL                                \
+                                        ? 0 : (vectorPtr)->cap * sizeof(*(vectorPtr)->content), \
+                                    (newCap))
+
+/**
+ * Records the destruction of the given vector.
+ *
+ * @param vectorPtr the pointer to the vector
+ */
+# define __dc4c_vector_stats_destroy(vectorPtr) \
+    __dc4c_vector_stats_record_destroy(__dc4c_vector_stats_of(vectorPtr), (vectorPtr)->cap, (vectorPtr)->count)
+
+/**
+ * Records the given amount of bytes moved inside of the given vector.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param bytes the amount of moved bytes
+ */
+# define __dc4c_vector_stats_move(vectorPtr, bytes) \
+    __dc4c_vector_stats_add(__dc4c_vector_stats_of(vectorPtr), bytesMoved, (bytes))
+
+/**
+ * Records the given amount of bytes copied into the given vector.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @param bytes the amount of copied bytes
+ */
+# define __dc4c_vector_stats_copy(vectorPtr, bytes) \
+    __dc4c_vector_stats_add(__dc4c_vector_stats_of(vectorPtr), bytesCopied, (bytes))
+
+/**
+ * @brief Returns the statistics of the type of the given vector.
+ *
+ * The statistics of all vectors defined with the same name are shared.
+ *
+ * @param vectorPtr the pointer to the vector
+ * @return the statistics or @c NULL if the type is not registered
+ */
+# define vector_stats_of(vectorPtr) ((const struct vector_stats*) __dc4c_vector_stats_of(vectorPtr))
+
+/**
+ * @brief Iterates over the statistics of all registered vector types.
+ *
+ * The counters are updated concurrently by other threads using vectors.
+ *
+ * @param varname the name of the variable holding a pointer to the current statistics
+ * @param block the block to be executed
+ */
+# define vector_stats_forEach(varname, block)                                                        \
+do {                                                                                                 \
+    for (const struct vector_stats* varname = __dc4c_vector_stats_list; varname != NULL;             \
+         varname = varname->next) {                                                                  \
+        { block }                                                                                    \
+    }                                                                                                \
+} while (0)
+
+/**
+ * Resets the counters of all registered vector types.
+ */
+# define vector_stats_reset()                                                                        \
+do {                                                                                                 \
+    for (struct vector_stats* __s_vsr = __dc4c_vector_stats_list; __s_vsr != NULL;                   \
+         __s_vsr = __s_vsr->next) {                                                                  \
+        __atomic_store_n(&__s_vsr->reallocations,  0, __ATOMIC_RELAXED);                             \
+        __atomic_store_n(&__s_vsr->bytesCopied,    0, __ATOMIC_RELAXED);                             \
+        __atomic_store_n(&__s_vsr->bytesMoved,     0, __ATOMIC_RELAXED);                             \
+        __atomic_store_n(&__s_vsr->peakCapacity,   0, __ATOMIC_RELAXED);                             \
+        __atomic_store_n(&__s_vsr->wastedCapacity, 0, __ATOMIC_RELAXED);                             \
+    }                                                                                                \
+} while (0)
+
+/**
+ * Prints the statistics of all registered vector types as a table into the given stream.
+ *
+ * @param stream the stream to print to
+ */
+# define vector_stats_dump(stream)                                                               \
+do {                                                                                             \
+    FILE* __f_vsd = (stream);                                                                    \
+                                                                                                 \
+    fprintf(__f_vsd, "%-24s %8s %14s %14s %14s %14s %14s\n", "vector", "element",                \
+            "reallocations", "bytes copied", "bytes moved", "peak capacity", "wasted capacity"); \
+    vector_stats_forEach(__s_vsd, {                                                              \
+        fprintf(__f_vsd, "%-24s %8zu %14zu %14zu %14zu %14zu %14zu\n", __s_vsd->name,            \
+                __s_vsd->elementSize,                                                            \
+                __atomic_load_n(&__s_vsd->reallocations,  __ATOMIC_RELAXED),                     \
+                __atomic_load_n(&__s_vsd->bytesCopied,    __ATOMIC_RELAXED),                     \
+                __atomic_load_n(&__s_vsd->bytesMoved,     __ATOMIC_RELAXED),                     \
+                __atomic_load_n(&__s_vsd->peakCapacity,   __ATOMIC_RELAXED),                     \
+                __atomic_load_n(&__s_vsd->wastedCapacity, __ATOMIC_RELAXED));                    \
+    });                                                                                          \
+} while (0)
+
+# endif /* __DC4C_vector_stats_h */
+#endif /* !__DC4C_vector_h */
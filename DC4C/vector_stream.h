@@ -0,0 +1,734 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_vector_stream_h
+#define __DC4C_vector_stream_h
+
+#include <pthread.h>
+
+#include "vector_file.h"
+
+#ifndef DC4C_VECTOR_STREAM_CHUNK_SIZE
+/** The default size of a chunk in bytes. */
+# define DC4C_VECTOR_STREAM_CHUNK_SIZE (1024 * 1024)
+#endif
+
+/** The alignment of the chunk buffers and of the written chunks. */
+#define __DC4C_VECTOR_STREAM_ALIGNMENT 4096
+
+/**
+ * @brief Represents a writer streaming elements into a DC4C vector file.
+ *
+ * The elements are collected in an aligned buffer that is written as one
+ * chunk whenever it is full.
+ */
+struct vector_writer {
+    /** The file descriptor written to.                  */
+    int            fd;
+    /** The offset of the file in the file descriptor.   */
+    off_t          start;
+    /** The path of the temporary file or @c NULL .      */
+    char*          tmpPath;
+    /** The path of the file or @c NULL .                */
+    char*          path;
+    /** The size of one element.                         */
+    size_t         elementSize;
+    /** The tag identifying the type of the elements.    */
+    uint64_t       typeTag;
+    /** The chunk buffer.                                */
+    unsigned char* buffer;
+    /** The size of the chunk buffer.                    */
+    size_t         bufferSize;
+    /** The amount of bytes used in the chunk buffer.    */
+    size_t         used;
+    /** The amount of bytes already written to the file. */
+    uint64_t       written;
+    /** The state of the checksum of the written bytes.  */
+    uint64_t       checksum;
+    /** The error that occurred while writing or zero.   */
+    int            error;
+};
+
+/**
+ * @brief Represents a reader streaming the elements of a DC4C vector file
+ * chunk by chunk.
+ *
+ * The next chunk is read ahead on a background thread while the current one
+ * is processed.
+ */
+struct vector_reader {
+    /** The file descriptor of the file.                         */
+    int             fd;
+    /** The size of one element.                                 */
+    size_t          elementSize;
+    /** The amount of elements in the file.                      */
+    size_t          count;
+    /** The maximum amount of elements per chunk.                */
+    size_t          chunkCount;
+    /** The amount of elements not yet read from the file.       */
+    size_t          remaining;
+    /** The two chunk buffers.                                   */
+    unsigned char*  buffers[2];
+    /** The amount of elements in the chunk buffers.             */
+    size_t          counts[2];
+    /** Whether the chunk buffers hold a chunk not yet released. */
+    bool            filled[2];
+    /** The index of the next chunk buffer to be handed out.     */
+    int             next;
+    /** The index of the handed out chunk buffer or @c -1 .      */
+    int             held;
+    /** Whether the background thread should stop.               */
+    bool            stop;
+    /** The error that occurred while reading or zero.           */
+    int             error;
+    /** The background thread reading ahead.                     */
+    pthread_t       thread;
+    /** The mutex protecting the chunk buffers.                  */
+    pthread_mutex_t mutex;
+    /** The condition signalled when a chunk buffer changes.     */
+    pthread_cond_t  condition;
+};
+
+/**
+ * Writes the filled chunk buffer of the given writer.
+ *
+ * @param writer the writer
+ * @return whether the chunk was written
+ */
+static inline bool __dc4c_vector_writer_flush(struct vector_writer* writer) {
+    const size_t skip = writer->written == 0 ? sizeof(struct __dc4c_vector_file_header) : 0;
+    writer->checksum = __dc4c_vector_file_checksum_update(writer->checksum, writer->buffer + skip, writer->used - skip);
+    if (!__dc4c_vector_file_write(writer->fd, writer->buffer, writer->used)) {
+        writer->error = errno;
+        return false;
+    }
+    writer->written += writer->used;
+    writer->used     = 0;
+    return true;
+}
+
+/**
+ * @brief Appends the given bytes to the given writer.
+ *
+ * Full chunks are written to the file.
+ *
+ * @param writer the writer
+ * @param data the bytes to be appended
+ * @param size the amount of bytes
+ * @return whether the bytes were appended
+ */
+static inline bool __dc4c_vector_writer_append(struct vector_writer* writer, const void* data, size_t size) {
+    if (writer->error != 0) {
+        errno = writer->error;
+        return false;
+    }
+    const unsigned char* bytes = (const unsigned char*) data;
+    while (size > 0) {
+        const size_t space = writer->bufferSize - writer->used;
+        const size_t chunk = size < space ? size : space;
+        memcpy(writer->buffer + writer->used, bytes, chunk);
+        writer->used += chunk;
+        bytes        += chunk;
+        size         -= chunk;
+        if (writer->used == writer->bufferSize && !__dc4c_vector_writer_flush(writer)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Opens the given writer for the given file descriptor.
+ *
+ * The file starts at the current offset of the file descriptor, which needs
+ * to be seekable, as the header is written when the writer is closed.
+ *
+ * @param writer the writer
+ * @param fd the file descriptor
+ * @param elementSize the size of one element
+ * @param typeTag the tag identifying the type of the elements
+ * @param chunkSize the size of the chunks in bytes, zero for the default
+ * @return whether the writer was opened, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_writer_open_fd(struct vector_writer* writer,
+                                                int                   fd,
+                                                size_t                elementSize,
+                                                uint64_t              typeTag,
+                                                size_t                chunkSize) {
+    if (chunkSize == 0) {
+        chunkSize = DC4C_VECTOR_STREAM_CHUNK_SIZE;
+    }
+    chunkSize = (chunkSize + __DC4C_VECTOR_STREAM_ALIGNMENT - 1) / __DC4C_VECTOR_STREAM_ALIGNMENT
+              * __DC4C_VECTOR_STREAM_ALIGNMENT;
+
+    writer->start = lseek(fd, 0, SEEK_CUR);
+    if (writer->start < 0) {
+        return false;
+    }
+    writer->buffer = NULL;
+    if (posix_memalign((void**) &writer->buffer, __DC4C_VECTOR_STREAM_ALIGNMENT, chunkSize) != 0) {
+        errno = ENOMEM;
+        return false;
+    }
+    writer->fd          = fd;
+    writer->tmpPath     = NULL;
+    writer->path        = NULL;
+    writer->elementSize = elementSize;
+    writer->typeTag     = typeTag;
+    writer->bufferSize  = chunkSize;
+    writer->written     = 0;
+    writer->checksum    = __DC4C_VECTOR_FILE_CHECKSUM_SEED;
+    writer->error       = 0;
+
+    // The header is written when the writer is closed.
+    writer->used = sizeof(struct __dc4c_vector_file_header);
+    memset(writer->buffer, 0, writer->used);
+    return true;
+}
+
+/**
+ * @brief Opens the given writer for the file at the given path.
+ *
+ * The file is written under a unique temporary name and renamed when the
+ * writer is closed.
+ *
+ * @param writer the writer
+ * @param path the path of the file
+ * @param elementSize the size of one element
+ * @param typeTag the tag identifying the type of the elements
+ * @param chunkSize the size of the chunks in bytes, zero for the default
+ * @return whether the writer was opened, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_writer_open(struct vector_writer* writer,
+                                             const char*           path,
+                                             size_t                elementSize,
+                                             uint64_t              typeTag,
+                                             size_t                chunkSize) {
+    const size_t pathLength = strlen(path);
+    char* pathCopy = (char*) malloc(pathLength + 1);
+    if (pathCopy == NULL) {
+        errno = ENOMEM;
+        return false;
+    }
+    memcpy(pathCopy, path, pathLength + 1);
+
+    char* tmpPath;
+    const int fd = __dc4c_vector_file_create_temporary(path, &tmpPath);
+    if (fd < 0 || !__dc4c_vector_writer_open_fd(writer, fd, elementSize, typeTag, chunkSize)) {
+        const int error = errno;
+        if (fd >= 0) {
+            close(fd);
+            unlink(tmpPath);
+            free(tmpPath);
+        }
+        free(pathCopy);
+        errno = error;
+        return false;
+    }
+    writer->tmpPath = tmpPath;
+    writer->path    = pathCopy;
+    return true;
+}
+
+/**
+ * @brief Closes the given writer.
+ *
+ * The remaining elements and the header are written. If the writer was opened
+ * for a path, the file is synchronized and renamed to its final path, it is
+ * removed if an error occurred. A given file descriptor is left open.
+ *
+ * @param writer the writer
+ * @return whether the file was written successfully, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_writer_close(struct vector_writer* writer) {
+    bool toReturn = writer->error == 0 && __dc4c_vector_writer_flush(writer);
+    if (toReturn) {
+        const uint64_t bytes = writer->written - sizeof(struct __dc4c_vector_file_header);
+
+        struct __dc4c_vector_file_header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, __DC4C_VECTOR_FILE_MAGIC, sizeof(__DC4C_VECTOR_FILE_MAGIC));
+        header.version     = __DC4C_VECTOR_FILE_VERSION;
+        header.byteOrder   = __DC4C_VECTOR_FILE_BYTE_ORDER;
+        header.elementSize = writer->elementSize;
+        header.count       = bytes / writer->elementSize;
+        header.typeTag     = writer->typeTag;
+        header.checksum    = writer->checksum ^ bytes;
+
+        ssize_t result;
+        do {
+            result = pwrite(writer->fd, &header, sizeof(header), writer->start);
+        } while (result < 0 && errno == EINTR);
+        toReturn = result == (ssize_t) sizeof(header);
+        if (result >= 0 && !toReturn) {
+            errno = EIO;
+        }
+    } else {
+        errno = writer->error;
+    }
+    if (writer->path != NULL) {
+        toReturn = __dc4c_vector_file_replace(writer->fd, writer->tmpPath, writer->path, toReturn);
+    }
+    free(writer->path);
+    free(writer->tmpPath);
+    free(writer->buffer);
+    return toReturn;
+}
+
+/**
+ * Reads the given amount of bytes at the given offset from the given file descriptor.
+ *
+ * @param fd the file descriptor
+ * @param data the buffer to read into
+ * @param size the amount of bytes to be read
+ * @param offset the offset in the file
+ * @return whether all bytes were read
+ */
+static inline bool __dc4c_vector_file_read(int fd, void* data, size_t size, off_t offset) {
+    unsigned char* bytes = (unsigned char*) data;
+    while (size > 0) {
+        const ssize_t result = pread(fd, bytes, size, offset);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (result == 0) {
+            errno = EIO;
+            return false;
+        }
+        bytes  += result;
+        size   -= (size_t) result;
+        offset += result;
+    }
+    return true;
+}
+
+/**
+ * @brief The function run by the background thread of a reader.
+ *
+ * The chunk buffers are filled alternately as soon as they have been released.
+ * An empty chunk marks the end of the file or an error.
+ *
+ * @param argument the reader
+ * @return @c NULL
+ */
+static inline void* __dc4c_vector_reader_run(void* argument) {
+    struct vector_reader* reader = (struct vector_reader*) argument;
+
+    off_t offset = sizeof(struct __dc4c_vector_file_header);
+    for (int index = 0;; index ^= 1) {
+        pthread_mutex_lock(&reader->mutex);
+        while (reader->filled[index] && !reader->stop) {
+            pthread_cond_wait(&reader->condition, &reader->mutex);
+        }
+        const bool stop = reader->stop;
+        pthread_mutex_unlock(&reader->mutex);
+        if (stop) break;
+
+        size_t count = reader->remaining < reader->chunkCount ? reader->remaining : reader->chunkCount;
+        int error = 0;
+        if (!__dc4c_vector_file_read(reader->fd, reader->buffers[index], count * reader->elementSize, offset)) {
+            error = errno;
+            count = 0;
+        }
+        offset            += (off_t) (count * reader->elementSize);
+        reader->remaining -= count;
+
+        pthread_mutex_lock(&reader->mutex);
+        reader->counts[index] = count;
+        reader->filled[index] = true;
+        reader->error         = error;
+        pthread_cond_broadcast(&reader->condition);
+        pthread_mutex_unlock(&reader->mutex);
+        if (count == 0) break;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Opens the given reader for the file at the given path.
+ *
+ * The header of the file is validated against the given element size and
+ * type tag, the background thread is started afterwards.
+ *
+ * @param reader the reader
+ * @param path the path of the file
+ * @param elementSize the expected size of one element
+ * @param typeTag the expected type tag
+ * @param chunkCount the maximum amount of elements per chunk, zero for the default
+ * @return whether the reader was opened, @c errno is set otherwise
+ */
+static inline bool __dc4c_vector_reader_open(struct vector_reader* reader,
+                                             const char*           path,
+                                             size_t                elementSize,
+                                             uint64_t              typeTag,
+                                             size_t                chunkCount) {
+    if (chunkCount == 0) {
+        chunkCount = DC4C_VECTOR_STREAM_CHUNK_SIZE / elementSize;
+        if (chunkCount == 0) {
+            chunkCount = 1;
+        }
+    }
+    reader->fd = open(path, O_RDONLY);
+    if (reader->fd < 0) {
+        return false;
+    }
+    struct __dc4c_vector_file_header header;
+    struct stat info;
+    if (!__dc4c_vector_file_read(reader->fd, &header, sizeof(header), 0) || fstat(reader->fd, &info) != 0) {
+        const int error = errno;
+        close(reader->fd);
+        errno = error;
+        return false;
+    }
+    if (!__dc4c_vector_file_header_valid(&header, (uint64_t) info.st_size, elementSize, typeTag)) {
+        close(reader->fd);
+        errno = EINVAL;
+        return false;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(reader->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    const size_t size = (chunkCount * elementSize + __DC4C_VECTOR_STREAM_ALIGNMENT - 1)
+                      / __DC4C_VECTOR_STREAM_ALIGNMENT * __DC4C_VECTOR_STREAM_ALIGNMENT;
+    reader->buffers[0] = NULL;
+    reader->buffers[1] = NULL;
+    if (posix_memalign((void**) &reader->buffers[0], __DC4C_VECTOR_STREAM_ALIGNMENT, size) != 0
+        || posix_memalign((void**) &reader->buffers[1], __DC4C_VECTOR_STREAM_ALIGNMENT, size) != 0) {
+        free(reader->buffers[0]);
+        close(reader->fd);
+        errno = ENOMEM;
+        return false;
+    }
+    reader->elementSize = elementSize;
+    reader->count       = (size_t) header.count;
+    reader->chunkCount  = chunkCount;
+    reader->remaining   = (size_t) header.count;
+    reader->counts[0]   = reader->counts[1] = 0;
+    reader->filled[0]   = reader->filled[1] = false;
+    reader->next        = 0;
+    reader->held        = -1;
+    reader->stop        = false;
+    reader->error       = 0;
+    pthread_mutex_init(&reader->mutex, NULL);
+    pthread_cond_init(&reader->condition, NULL);
+
+    const int error = pthread_create(&reader->thread, NULL, __dc4c_vector_reader_run, reader);
+    if (error != 0) {
+        pthread_cond_destroy(&reader->condition);
+        pthread_mutex_destroy(&reader->mutex);
+        free(reader->buffers[0]);
+        free(reader->buffers[1]);
+        close(reader->fd);
+        errno = error;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Hands out the next chunk of the given reader.
+ *
+ * The previously handed out chunk is released to be refilled.
+ *
+ * @param reader the reader
+ * @param content the pointer receiving the address of the elements of the chunk
+ * @param count the pointer receiving the amount of elements of the chunk
+ * @return whether a chunk was handed out
+ */
+static inline bool __dc4c_vector_reader_next(struct vector_reader* reader, void** content, size_t* count) {
+    pthread_mutex_lock(&reader->mutex);
+    if (reader->held >= 0) {
+        reader->filled[reader->held] = false;
+        reader->held                 = -1;
+        pthread_cond_broadcast(&reader->condition);
+    }
+    while (!reader->filled[reader->next]) {
+        pthread_cond_wait(&reader->condition, &reader->mutex);
+    }
+    const bool toReturn = reader->counts[reader->next] > 0;
+    if (toReturn) {
+        *content     = reader->buffers[reader->next];
+        *count       = reader->counts[reader->next];
+        reader->held = reader->next;
+        reader->next ^= 1;
+    }
+    pthread_mutex_unlock(&reader->mutex);
+    return toReturn;
+}
+
+/**
+ * @brief Closes the given reader.
+ *
+ * The background thread is stopped and all resources are released.
+ *
+ * @param reader the reader
+ */
+static inline void __dc4c_vector_reader_close(struct vector_reader* reader) {
+    pthread_mutex_lock(&reader->mutex);
+    reader->stop = true;
+    pthread_cond_broadcast(&reader->condition);
+    pthread_mutex_unlock(&reader->mutex);
+    pthread_join(reader->thread, NULL);
+
+    pthread_cond_destroy(&reader->condition);
+    pthread_mutex_destroy(&reader->mutex);
+    free(reader->buffers[0]);
+    free(reader->buffers[1]);
+    close(reader->fd);
+}
+
+/**
+ * @brief Opens the given writer for the file at the given path.
+ *
+ * The elements are collected in an aligned buffer of the given size, rounded
+ * up to a multiple of the page size, which is written as one chunk whenever
+ * it is full. The written file has the format of @c vector_save and can be
+ * read using @c vector_map or a reader. It is written under a unique
+ * temporary name and renamed to the given path when the writer is closed.
+ *
+ * @param writerPtr the pointer to the writer
+ * @param path the path of the file
+ * @param elementSize the size of one element
+ * @param typeTag the tag identifying the type of the elements
+ * @param chunkSize the size of the chunks in bytes, zero for @c DC4C_VECTOR_STREAM_CHUNK_SIZE
+ * @return whether the writer was opened, @c errno is set otherwise
+ */
+#define vector_writer_open(writerPtr, path, elementSize, typeTag, chunkSize) \
+    __dc4c_vector_writer_open((writerPtr), (path), (elementSize), (uint64_t) (typeTag), (chunkSize))
+
+/**
+ * @brief Opens the given writer for the given file descriptor.
+ *
+ * The chunks are written sequentially to the file descriptor, starting at its
+ * current offset, and the header is written at that offset when the writer is
+ * closed; the file descriptor therefore needs to be seekable. It is neither
+ * synchronized nor closed by the writer. The file is readable by
+ * @c vector_map or a reader if the writer started at the beginning of an
+ * empty file.
+ *
+ * @param writerPtr the pointer to the writer
+ * @param fd the file descriptor
+ * @param elementSize the size of one element
+ * @param typeTag the tag identifying the type of the elements
+ * @param chunkSize the size of the chunks in bytes, zero for @c DC4C_VECTOR_STREAM_CHUNK_SIZE
+ * @return whether the writer was opened, @c errno is set otherwise
+ */
+#define vector_writer_open_fd(writerPtr, fd, elementSize, typeTag, chunkSize) \
+    __dc4c_vector_writer_open_fd((writerPtr), (fd), (elementSize), (uint64_t) (typeTag), (chunkSize))
+
+/**
+ * @brief Appends the given value to the given writer.
+ *
+ * The value is written as it is, only its size is checked against the element
+ * size of the writer. To convert it to the element type before, use
+ * @c vector_writer_push_back_as .
+ *
+ * @param writerPtr the pointer to the writer
+ * @param value the value to be written
+ * @return whether the value was appended, @c errno is set otherwise
+ */
+#define vector_writer_push_back(writerPtr, value) ({                      \
+    struct vector_writer* __w_vwp = (writerPtr);                          \
+    __DC4C_VALUE_TYPEOF(value) __vwp_value = (value);                     \
+                                                                          \
+    bool __vwp_result = sizeof(__vwp_value) == __w_vwp->elementSize;      \
+    if (__vwp_result) {                                                   \
+        __vwp_result = __dc4c_vector_writer_append(__w_vwp, &__vwp_value, \
+                                                   sizeof(__vwp_value));  \
+    } else {                                                              \
+        errno = EINVAL;                                                   \
+    }                                                                     \
+    __vwp_result;                                                         \
+})
+
+/**
+ * @brief Appends the given value converted to the given type to the given writer.
+ *
+ * The value is converted like by an assignment to the given type, the size of
+ * which must match the element size of the writer.
+ *
+ * @param writerPtr the pointer to the writer
+ * @param type the element type of the writer
+ * @param value the value to be written
+ * @return whether the value was appended, @c errno is set otherwise
+ */
+#define vector_writer_push_back_as(writerPtr, type, value) ({ \
+    type __vwpa_value = (value);                              \
+    vector_writer_push_back((writerPtr), __vwpa_value);       \
+})
+
+/**
+ * @brief Appends all elements of the given vector to the given writer.
+ *
+ * The size of the elements must match the element size of the writer.
+ *
+ * @param writerPtr the pointer to the writer
+ * @param vectorPtr the pointer to the vector
+ * @return whether the elements were appended, @c errno is set otherwise
+ */
+#define vector_writer_append(writerPtr, vectorPtr) ({                            \
+    struct vector_writer* __w_vwa = (writerPtr);                                 \
+    __DC4C_TYPEOF((vectorPtr)) __v_vwa = (vectorPtr);                            \
+                                                                                 \
+    bool __vwa_result = sizeof(*__v_vwa->content) == __w_vwa->elementSize;       \
+    if (__vwa_result) {                                                          \
+        __vwa_result = __dc4c_vector_writer_append(__w_vwa, __v_vwa->content,    \
+                                                   __v_vwa->count                \
+                                                   * sizeof(*__v_vwa->content)); \
+    } else {                                                                     \
+        errno = EINVAL;                                                          \
+    }                                                                            \
+    __vwa_result;                                                                \
+})
+
+/**
+ * Returns the amount of elements appended to the given writer.
+ *
+ * @param writerPtr the pointer to the writer
+ * @return the amount of appended elements
+ */
+#define vector_writer_size(writerPtr) ({                                                    \
+    const struct vector_writer* __w_vws = (writerPtr);                                      \
+                                                                                            \
+    (size_t) ((__w_vws->written + __w_vws->used - sizeof(struct __dc4c_vector_file_header)) \
+              / __w_vws->elementSize);                                                      \
+})
+
+/**
+ * @brief Closes the given writer.
+ *
+ * The remaining elements and the header are written. If the writer was opened
+ * for a path, the file is synchronized to disk and renamed to its final path;
+ * if an error occurred while writing, the file is removed. A file descriptor
+ * given to @c vector_writer_open_fd is left open. The writer needs to be
+ * reopened before being used again.
+ *
+ * @param writerPtr the pointer to the writer
+ * @return whether the file was written successfully, @c errno is set otherwise
+ */
+#define vector_writer_close(writerPtr) __dc4c_vector_writer_close((writerPtr))
+
+/**
+ * @brief Opens the given reader for the file at the given path.
+ *
+ * The file must have been written by @c vector_save or a writer. Its header
+ * is validated against the given element size and type tag. A background
+ * thread starts reading the first chunks ahead immediately. The checksum is
+ * not verified.
+ *
+ * @param readerPtr the pointer to the reader
+ * @param path the path of the file
+ * @param elementSize the expected size of one element
+ * @param typeTag the expected type tag
+ * @param chunkCount the maximum amount of elements per chunk, zero to derive it from @c DC4C_VECTOR_STREAM_CHUNK_SIZE
+ * @return whether the reader was opened, @c errno is set otherwise
+ */
+#define vector_reader_open(readerPtr, path, elementSize, typeTag, chunkCount) \
+    __dc4c_vector_reader_open((readerPtr), (path), (elementSize), (uint64_t) (typeTag), (chunkCount))
+
+/**
+ * @brief Exposes the next chunk of the given reader as the given vector.
+ *
+ * The vector is a read-only view of the chunk, it stays valid until the next
+ * chunk is requested or the reader is closed and must neither be modified nor
+ * destroyed. The previous chunk is handed back to be refilled in the
+ * background. If the end of the file is reached or an error occurred, the
+ * given vector is left unchanged.
+ *
+ * @param readerPtr the pointer to the reader
+ * @param vectorPtr the pointer to the vector
+ * @return whether a chunk was exposed, see @c vector_reader_error otherwise
+ */
+#define vector_reader_next(readerPtr, vectorPtr) ({                                 \
+    __DC4C_TYPEOF((vectorPtr)) __v_vrn = (vectorPtr);                               \
+                                                                                    \
+    void*  __c_vrn;                                                                 \
+    size_t __n_vrn;                                                                 \
+    bool __vrn_result = __dc4c_vector_reader_next((readerPtr), &__c_vrn, &__n_vrn); \
+    if (__vrn_result) {                                                             \
+        __v_vrn->content = (__DC4C_TYPEOF(__v_vrn->content)) __c_vrn;               \
+        __v_vrn->count   = __n_vrn;                                                 \
+        __v_vrn->cap     = __n_vrn;                                                 \
+    }                                                                               \
+    __vrn_result;                                                                   \
+})
+
+/**
+ * @brief Iterates over all elements of the given reader.
+ *
+ * The chunks are exposed one after another as the given vector, which is
+ * iterated using @c vector_forEach .
+ *
+ * @param readerPtr the pointer to the reader
+ * @param vectorPtr the pointer to the vector used as view of the chunks
+ * @param varname the name of the variable holding a pointer to the current element
+ * @param block the block to be executed
+ */
+#define vector_reader_forEach(readerPtr, vectorPtr, varname, block) \
+do {                                                                \
+    struct vector_reader* __r_vrf = (readerPtr);                    \
+    __DC4C_TYPEOF((vectorPtr)) __v_vrf = (vectorPtr);               \
+                                                                    \
+    while (vector_reader_next(__r_vrf, __v_vrf)) {                  \
+        vector_forEach(__v_vrf, varname, block);                    \
+    }                                                               \
+} while (0)
+
+/**
+ * Returns the amount of elements in the file of the given reader.
+ *
+ * @param readerPtr the pointer to the reader
+ * @return the amount of elements in the file
+ */
+#define vector_reader_size(readerPtr) ({               \
+    const struct vector_reader* __r_vrs = (readerPtr); \
+                                                       \
+    __r_vrs->count;                                    \
+})
+
+/**
+ * @brief Returns the error that occurred while reading ahead.
+ *
+ * It should be checked once @c vector_reader_next returned @c false .
+ *
+ * @param readerPtr the pointer to the reader
+ * @return the @c errno value of the error or zero if the end of the file was reached
+ */
+#define vector_reader_error(readerPtr) ({        \
+    struct vector_reader* __r_vre = (readerPtr); \
+                                                 \
+    pthread_mutex_lock(&__r_vre->mutex);         \
+    const int __vre_result = __r_vre->error;     \
+    pthread_mutex_unlock(&__r_vre->mutex);       \
+    __vre_result;                                \
+})
+
+/**
+ * @brief Closes the given reader.
+ *
+ * The background thread is stopped; views of the chunks become invalid. The
+ * reader needs to be reopened before being used again.
+ *
+ * @param readerPtr the pointer to the reader
+ */
+#define vector_reader_close(readerPtr) __dc4c_vector_reader_close((readerPtr))
+
+#ifdef __cplusplus
+# include "vector_stream.hpp"
+#endif
+
+#endif /* __DC4C_vector_stream_h */
@@ -0,0 +1,238 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#if __cplusplus < 201103L
+# error This library requires C++11 or newer.
+#endif
+
+#ifndef __DC4C_vector_stream_h
+# warning Wrong inclusion of "vector_stream.hpp" redirected to #include "vector_stream.h"!
+# include "vector_stream.h"
+#else
+# ifndef __DC4C_vector_stream_hpp
+# define __DC4C_vector_stream_hpp
+
+# include <cstdint>
+# include <system_error>
+# include <type_traits>
+# include <utility>
+
+namespace dc4c {
+/**
+ * @brief This class acts as a RAII compatible wrapper class for a writer
+ * streaming the elements of C vectors into a file.
+ *
+ * If the writer is not closed explicitly, it is closed by the destructor and
+ * errors are ignored.
+ *
+ * @tparam T the C DC4C vector type
+ */
+template<typename T>
+class stream_writer {
+    /** The underlying C writer.            */
+    ::vector_writer underlying;
+    /** Whether the writer is still opened. */
+    bool opened;
+
+public:
+    /** The type stored in the written vectors. */
+    using value_type = typename std::decay<decltype(*std::declval<T>().content)>::type;
+
+    /**
+     * Opens the writer for the file at the given path.
+     *
+     * @param path the path of the file
+     * @param typeTag the tag identifying the type of the elements
+     * @param chunkSize the size of the chunks in bytes, zero for the default
+     * @throw std::system_error if the file could not be opened
+     */
+    inline stream_writer(const char* path, std::uint64_t typeTag, std::size_t chunkSize = 0): opened(true) {
+        if (!vector_writer_open(&underlying, path, sizeof(value_type), typeTag, chunkSize)) {
+            throw std::system_error(errno, std::generic_category(), path);
+        }
+    }
+
+    /**
+     * Opens the writer for the given seekable file descriptor, which is left
+     * open when the writer is closed.
+     *
+     * @param fd the file descriptor
+     * @param typeTag the tag identifying the type of the elements
+     * @param chunkSize the size of the chunks in bytes, zero for the default
+     * @throw std::system_error if the writer could not be opened
+     */
+    inline stream_writer(int fd, std::uint64_t typeTag, std::size_t chunkSize = 0): opened(true) {
+        if (!vector_writer_open_fd(&underlying, fd, sizeof(value_type), typeTag, chunkSize)) {
+            throw std::system_error(errno, std::generic_category());
+        }
+    }
+
+    stream_writer(const stream_writer&) = delete;
+
+    inline ~stream_writer() {
+        if (opened) {
+            vector_writer_close(&underlying);
+        }
+    }
+
+    auto operator=(const stream_writer&) -> stream_writer& = delete;
+
+    /**
+     * Appends the given value.
+     *
+     * @param value the value to be written
+     * @throw std::system_error if the value could not be written
+     */
+    inline void push_back(const value_type& value) {
+        if (!vector_writer_push_back(&underlying, value)) {
+            throw std::system_error(errno, std::generic_category());
+        }
+    }
+
+    /**
+     * Appends all elements of the given vector.
+     *
+     * @param other the vector whose elements to write
+     * @throw std::system_error if the elements could not be written
+     */
+    inline void append(const vector<T>& other) {
+        if (!vector_writer_append(&underlying, &other.data())) {
+            throw std::system_error(errno, std::generic_category());
+        }
+    }
+
+    /**
+     * Returns the amount of appended elements.
+     *
+     * @return the amount of appended elements
+     */
+    inline auto size() const noexcept -> std::size_t {
+        return vector_writer_size(&underlying);
+    }
+
+    /**
+     * Writes the remaining elements and the header; a file opened by its path
+     * is renamed to its final path.
+     *
+     * @throw std::system_error if the file could not be written
+     */
+    inline void close() {
+        opened = false;
+        if (!vector_writer_close(&underlying)) {
+            throw std::system_error(errno, std::generic_category());
+        }
+    }
+};
+
+/**
+ * @brief This class acts as a RAII compatible wrapper class for a reader
+ * streaming a file chunk by chunk.
+ *
+ * @tparam T the C DC4C vector type
+ */
+template<typename T>
+class stream_reader {
+    /** The underlying C reader.                */
+    ::vector_reader underlying;
+    /** The C vector viewing the current chunk. */
+    T current;
+
+public:
+    /** The type stored in the read vectors. */
+    using value_type = typename std::decay<decltype(*current.content)>::type;
+
+    /**
+     * Opens the reader for the file at the given path.
+     *
+     * @param path the path of the file
+     * @param typeTag the expected type tag
+     * @param chunkCount the maximum amount of elements per chunk, zero for the default
+     * @throw std::system_error if the file could not be opened
+     */
+    inline stream_reader(const char* path, std::uint64_t typeTag, std::size_t chunkCount = 0): current(vector_initializer) {
+        if (!vector_reader_open(&underlying, path, sizeof(value_type), typeTag, chunkCount)) {
+            throw std::system_error(errno, std::generic_category(), path);
+        }
+    }
+
+    stream_reader(const stream_reader&) = delete;
+
+    inline ~stream_reader() {
+        vector_reader_close(&underlying);
+    }
+
+    auto operator=(const stream_reader&) -> stream_reader& = delete;
+
+    /**
+     * @brief Advances to the next chunk.
+     *
+     * The previous chunk becomes invalid.
+     *
+     * @return whether there was another chunk
+     * @throw std::system_error if the chunk could not be read
+     */
+    inline auto next() -> bool {
+        if (vector_reader_next(&underlying, &current)) {
+            return true;
+        }
+        const int error = vector_reader_error(&underlying);
+        if (error != 0) {
+            throw std::system_error(error, std::generic_category());
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the C vector viewing the current chunk.
+     *
+     * The returned vector must not be modified.
+     *
+     * @return the current chunk
+     */
+    constexpr inline auto chunk() const noexcept -> const T& {
+        return current;
+    }
+
+    /**
+     * Returns an iterator to the first element of the current chunk.
+     *
+     * @return a pointer to the first element of the current chunk
+     */
+    constexpr inline auto begin() const noexcept -> const value_type* {
+        return current.content;
+    }
+
+    /**
+     * Returns a past the end iterator of the current chunk.
+     *
+     * @return a pointer past the last element of the current chunk
+     */
+    constexpr inline auto end() const noexcept -> const value_type* {
+        return current.content + current.count;
+    }
+
+    /**
+     * Returns the amount of elements in the file.
+     *
+     * @return the amount of elements in the file
+     */
+    inline auto size() const noexcept -> std::size_t {
+        return vector_reader_size(&underlying);
+    }
+};
+}
+
+# endif /* __DC4C_vector_stream_hpp */
+#endif /* !__DC4C_vector_stream_h */
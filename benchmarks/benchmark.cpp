@@ -0,0 +1,722 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <btree.h>
+#include <optional.h>
+#include <pair.h>
+#include <sharded_vector.h>
+#include <vector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+/**
+ * @brief An element of the given size used by the benchmarks.
+ *
+ * The elements are ordered by their key.
+ *
+ * @tparam N the size of the element in bytes
+ */
+template<std::size_t N>
+struct element {
+    /** The key of the element.          */
+    std::uint64_t key;
+    /** The payload filling the element. */
+    unsigned char payload[N - sizeof(std::uint64_t)];
+};
+
+template<>
+struct element<sizeof(std::uint64_t)> {
+    /** The key of the element. */
+    std::uint64_t key;
+};
+
+typedef_vector_named(element8, element<8>);
+typedef_vector_named(element64, element<64>);
+typedef_vector_named(element256, element<256>);
+typedef_vector_named(index, std::size_t);
+
+/**
+ * Compares the given keys in the style of @c qsort .
+ *
+ * @param lhs the first key
+ * @param rhs the second key
+ * @return a negative value, zero or a positive value
+ */
+static inline auto compare_key(const std::uint64_t* lhs, const std::uint64_t* rhs) -> int {
+    return (*lhs > *rhs) - (*lhs < *rhs);
+}
+
+typedef_pair_named(benchmark, std::uint64_t, double);
+typedef_optional_named(benchmark, std::uint64_t);
+typedef_vector_named(benchmark, pair_benchmark_t);
+typedef_btree_named(benchmark, std::uint64_t, double, compare_key);
+typedef_vector_named(key, std::uint64_t);
+typedef_vector_named(real, double);
+typedef_sharded_vector_named(key, std::uint64_t);
+
+namespace dc4c {
+namespace benchmarks {
+/**
+ * Maps the size of an element to the C vector type holding it.
+ *
+ * @tparam N the size of the element
+ */
+template<std::size_t N>
+struct c_vector;
+
+template<>
+struct c_vector<8> {
+    using type = vector_element8_t;
+};
+
+template<>
+struct c_vector<64> {
+    using type = vector_element64_t;
+};
+
+template<>
+struct c_vector<256> {
+    using type = vector_element256_t;
+};
+
+/**
+ * Compares the given elements by their key in the style of @c qsort .
+ *
+ * @param lhs the first element
+ * @param rhs the second element
+ * @return a negative value, zero or a positive value
+ */
+template<std::size_t N>
+static inline auto compare(const element<N>* lhs, const element<N>* rhs) -> int {
+    return (lhs->key > rhs->key) - (lhs->key < rhs->key);
+}
+
+/**
+ * Returns whether the first given element is ordered before the second one.
+ *
+ * @param lhs the first element
+ * @param rhs the second element
+ * @return whether the key of the first element is smaller
+ */
+template<std::size_t N>
+static inline auto less(const element<N>& lhs, const element<N>& rhs) -> bool {
+    return lhs.key < rhs.key;
+}
+
+/**
+ * Prevents the compiler from optimizing away the computation of the given value.
+ *
+ * @param value the value to be kept
+ */
+template<typename T>
+static inline void keep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Creates the given amount of elements with pseudo random keys.
+ *
+ * @param count the amount of elements
+ * @return the created elements
+ */
+template<std::size_t N>
+static inline auto make_elements(std::size_t count) -> std::vector<element<N>> {
+    auto generator = std::mt19937_64(0xdc4c);
+    auto toReturn  = std::vector<element<N>>(count);
+    for (auto& e : toReturn) {
+        std::memset(&e, 0, sizeof(e));
+        e.key = generator();
+    }
+    return toReturn;
+}
+
+/**
+ * Represents the measurements of one benchmark.
+ */
+struct result {
+    /** The name of the benchmark.                            */
+    std::string           benchmark;
+    /** The name of the measured implementation.              */
+    std::string           implementation;
+    /** The size of one element.                              */
+    std::size_t           elementSize;
+    /** The amount of elements in the container.              */
+    std::size_t           count;
+    /** The amount of operations performed by one repetition. */
+    std::size_t           operations;
+    /** The durations of the repetitions in nanoseconds.      */
+    std::vector<double>   durations;
+    /** The hardware counters of the fastest repetition.      */
+    perf_counters::values counters;
+};
+
+/**
+ * This class runs the benchmarks and collects their results.
+ */
+class runner {
+    /** The hardware counters.                          */
+    perf_counters       counters;
+    /** The amount of repetitions per benchmark.        */
+    std::size_t         repetitions;
+    /** The filter the benchmark names need to contain. */
+    std::string         filter;
+    /** The results of the benchmarks run so far.       */
+    std::vector<result> results;
+
+public:
+    /**
+     * Constructs a runner.
+     *
+     * @param repetitions the amount of repetitions per benchmark
+     * @param filter the filter the benchmark names need to contain
+     */
+    inline runner(std::size_t repetitions, std::string filter): repetitions(repetitions), filter(std::move(filter)) {}
+
+    /**
+     * @brief Measures the given benchmark.
+     *
+     * The state is created by the given setup function before each repetition
+     * and destroyed afterwards, only the given run function is measured.
+     *
+     * @param benchmark the name of the benchmark
+     * @param implementation the name of the measured implementation
+     * @param elementSize the size of one element
+     * @param count the amount of elements
+     * @param operations the amount of operations performed by the run function
+     * @param setup the function creating the state
+     * @param run the function to be measured
+     */
+    template<typename Setup, typename Run>
+    inline void measure(const std::string& benchmark, const char* implementation, std::size_t elementSize,
+                        std::size_t count, std::size_t operations, Setup setup, Run run) {
+        if (benchmark.find(filter) == std::string::npos) return;
+
+        std::fprintf(stderr, "%-18s %-5s %4zu B x %9zu\n", benchmark.c_str(), implementation, elementSize, count);
+        auto toAdd = result { benchmark, implementation, elementSize, count, operations, {}, {} };
+        auto fastest = std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            auto state = setup();
+
+            counters.start();
+            const auto begin = std::chrono::steady_clock::now();
+            run(state);
+            const auto end = std::chrono::steady_clock::now();
+            const auto values = counters.stop();
+            keep(state);
+
+            const auto duration = std::chrono::duration<double, std::nano>(end - begin).count();
+            toAdd.durations.push_back(duration);
+            if (duration < fastest) {
+                fastest        = duration;
+                toAdd.counters = values;
+            }
+        }
+        results.push_back(std::move(toAdd));
+    }
+
+    /**
+     * Writes the results as JSON into the given stream.
+     *
+     * @param stream the stream to write to
+     */
+    inline void write_json(std::FILE* stream) const {
+        std::fprintf(stream, "{\n  \"perf_counters\": %s,\n  \"repetitions\": %zu,\n  \"results\": [",
+                     counters.available() ? "true" : "false", repetitions);
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            auto durations = r.durations;
+            std::sort(durations.begin(), durations.end());
+            const auto min    = durations.front();
+            const auto median = durations[durations.size() / 2];
+            const auto seconds = min / 1e9;
+
+            std::fprintf(stream, "%s\n    {\"benchmark\": \"%s\", \"implementation\": \"%s\", \"element_size\": %zu, "
+                                 "\"count\": %zu, \"operations\": %zu, \"min_ns\": %.0f, \"median_ns\": %.0f, "
+                                 "\"operations_per_second\": %.1f, \"bytes_per_second\": %.1f, \"counters\": ",
+                         i == 0 ? "" : ",", r.benchmark.c_str(), r.implementation.c_str(), r.elementSize, r.count,
+                         r.operations, min, median, seconds > 0 ? r.operations / seconds : 0.0,
+                         seconds > 0 ? r.operations * r.elementSize / seconds : 0.0);
+            if (counters.available()) {
+                std::fputc('{', stream);
+                for (std::size_t j = 0; j < perf_counters::count; ++j) {
+                    std::fprintf(stream, "%s\"%s\": %llu", j == 0 ? "" : ", ", perf_counters::names[j],
+                                 static_cast<unsigned long long>(r.counters[j]));
+                }
+                std::fputc('}', stream);
+            } else {
+                std::fputs("null", stream);
+            }
+            std::fputc('}', stream);
+        }
+        std::fputs("\n  ]\n}\n", stream);
+    }
+};
+
+/**
+ * Runs the vector benchmarks for elements of the given size.
+ *
+ * @tparam N the size of the elements
+ * @param r the runner
+ * @param count the amount of elements
+ */
+template<std::size_t N>
+static inline void run_vector(runner& r, std::size_t count) {
+    using C        = typename c_vector<N>::type;
+    using E        = element<N>;
+    using wrapper  = dc4c::vector<C>;
+    using standard = std::vector<E>;
+
+    // Insertions and erasures in the middle move half of the elements, so
+    // their amount is limited to move about 256 MiB per repetition.
+    const auto elements   = make_elements<N>(count);
+    const auto moved      = (std::size_t(256) << 20) / (count / 2 * N + 1);
+    const auto operations = std::max<std::size_t>(1, std::min<std::size_t>({ count, moved, 1000 }));
+    auto sorted = elements;
+    std::sort(sorted.begin(), sorted.end(), less<N>);
+
+    r.measure("push_back", "dc4c", N, count, count, [] { return wrapper(); }, [&](wrapper& v) {
+        for (const auto& e : elements) {
+            vector_push_back(&v.data(), e);
+        }
+    });
+    r.measure("push_back", "std", N, count, count, [] { return standard(); }, [&](standard& v) {
+        for (const auto& e : elements) {
+            v.push_back(e);
+        }
+    });
+
+    r.measure("insert", "dc4c", N, count, operations, [&] { return wrapper(elements); }, [&](wrapper& v) {
+        for (std::size_t i = 0; i < operations; ++i) {
+            vector_insert(&v.data(), elements[i], v.size() / 2);
+        }
+    });
+    r.measure("insert", "std", N, count, operations, [&] { return elements; }, [&](standard& v) {
+        for (std::size_t i = 0; i < operations; ++i) {
+            v.insert(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2), elements[i]);
+        }
+    });
+
+    r.measure("erase", "dc4c", N, count, operations, [&] { return wrapper(elements); }, [&](wrapper& v) {
+        for (std::size_t i = 0; i < operations; ++i) {
+            keep(vector_erase(&v.data(), v.size() / 2));
+        }
+    });
+    r.measure("erase", "std", N, count, operations, [&] { return elements; }, [&](standard& v) {
+        for (std::size_t i = 0; i < operations; ++i) {
+            v.erase(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2));
+        }
+    });
+
+    r.measure("sort", "dc4c", N, count, count, [&] { return wrapper(elements); }, [](wrapper& v) {
+        vector_sort(&v.data(), compare<N>);
+    });
+    r.measure("sort", "std", N, count, count, [&] { return elements; }, [](standard& v) {
+        std::sort(v.begin(), v.end(), less<N>);
+    });
+
+    r.measure("sort_by_index", "dc4c", N, count, count, [&] {
+        return std::make_pair(wrapper(elements), dc4c::vector_index());
+    }, [](std::pair<wrapper, dc4c::vector_index>& v) {
+        vector_argsort(&v.second.data(), &v.first.data(), compare<N>);
+        vector_apply_permutation(&v.first.data(), &v.second.data());
+    });
+    r.measure("sort_by_index", "std", N, count, count, [&] { return std::make_pair(elements, standard()); },
+              [](std::pair<standard, standard>& v) {
+        auto indices = std::vector<std::size_t>(v.first.size());
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = i;
+        }
+        std::stable_sort(indices.begin(), indices.end(), [&v](std::size_t lhs, std::size_t rhs) {
+            return less<N>(v.first[lhs], v.first[rhs]);
+        });
+        v.second.reserve(indices.size());
+        for (const auto index : indices) {
+            v.second.push_back(v.first[index]);
+        }
+    });
+
+    r.measure("search", "dc4c", N, count, count, [&] { return wrapper(sorted); }, [&](wrapper& v) {
+        std::size_t found = 0;
+        for (const auto& e : elements) {
+            found += vector_search(&v.data(), &e, compare<N>) != nullptr;
+        }
+        keep(found);
+    });
+    r.measure("search", "std", N, count, count, [&] { return sorted; }, [&](standard& v) {
+        std::size_t found = 0;
+        for (const auto& e : elements) {
+            const auto it = std::lower_bound(v.begin(), v.end(), e, less<N>);
+            found += it != v.end() && !less<N>(e, *it);
+        }
+        keep(found);
+    });
+
+    r.measure("copy", "dc4c", N, count, count, [&] { return std::make_pair(wrapper(elements), wrapper()); },
+              [](std::pair<wrapper, wrapper>& v) {
+        vector_copy(&v.second.data(), &v.first.data());
+    });
+    r.measure("copy", "std", N, count, count, [&] { return std::make_pair(elements, standard()); },
+              [](std::pair<standard, standard>& v) {
+        v.second = v.first;
+    });
+
+    r.measure("convert_to_std", "dc4c", N, count, count, [&] { return std::make_pair(wrapper(elements), standard()); },
+              [](std::pair<wrapper, standard>& v) {
+        v.second = static_cast<standard>(v.first);
+    });
+    r.measure("convert_to_std", "std", N, count, count, [&] { return std::make_pair(elements, standard()); },
+              [](std::pair<standard, standard>& v) {
+        v.second = standard(v.first);
+    });
+
+    r.measure("convert_from_std", "dc4c", N, count, count, [&] { return std::make_pair(elements, wrapper()); },
+              [](std::pair<standard, wrapper>& v) {
+        v.second = wrapper(v.first);
+    });
+    r.measure("convert_from_std", "std", N, count, count, [&] { return std::make_pair(elements, standard()); },
+              [](std::pair<standard, standard>& v) {
+        v.second = standard(v.first);
+    });
+}
+
+/**
+ * Runs the benchmarks of the round trips of pairs and optionals through
+ * @c to_cpp and @c to_dc4c .
+ *
+ * @param r the runner
+ * @param count the amount of pairs and optionals
+ */
+static inline void run_conversions(runner& r, std::size_t count) {
+    using pair     = dc4c::pair_benchmark;
+    using optional = dc4c::optional_benchmark;
+
+    auto pairs     = std::vector<pair>(count);
+    auto optionals = std::vector<optional>(count);
+    auto generator = std::mt19937_64(0xdc4c);
+    for (std::size_t i = 0; i < count; ++i) {
+        pairs[i] = make_pair_benchmark(generator(), static_cast<double>(i));
+        optionals[i].has_value = (generator() & 1) != 0;
+        optionals[i].value     = optionals[i].has_value ? generator() : 0;
+    }
+
+    r.measure("pair_round_trip", "dc4c", sizeof(pair), count, count, [&] { return std::vector<pair>(count); },
+              [&](std::vector<pair>& out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = dc4c::to_dc4c(dc4c::to_cpp(pairs[i]));
+        }
+    });
+    r.measure("pair_round_trip", "std", sizeof(pair), count, count, [&] {
+        auto toReturn = std::vector<std::pair<std::uint64_t, double>>();
+        toReturn.reserve(count);
+        for (const auto& p : pairs) {
+            toReturn.emplace_back(p.first, p.second);
+        }
+        return std::make_pair(toReturn, std::vector<std::pair<std::uint64_t, double>>(count));
+    }, [&](std::pair<std::vector<std::pair<std::uint64_t, double>>, std::vector<std::pair<std::uint64_t, double>>>& v) {
+        for (std::size_t i = 0; i < count; ++i) {
+            v.second[i] = std::make_pair(v.first[i].first, v.first[i].second);
+        }
+    });
+
+    r.measure("optional_round_trip", "dc4c", sizeof(optional), count, count,
+              [&] { return std::vector<optional>(count); }, [&](std::vector<optional>& out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = dc4c::to_dc4c(dc4c::to_cpp(optionals[i]));
+        }
+    });
+    r.measure("optional_round_trip", "std", sizeof(optional), count, count, [&] {
+        auto toReturn = std::vector<std::optional<std::uint64_t>>();
+        toReturn.reserve(count);
+        for (const auto& o : optionals) {
+            toReturn.push_back(dc4c::to_cpp(o));
+        }
+        return std::make_pair(toReturn, std::vector<std::optional<std::uint64_t>>(count));
+    }, [&](std::pair<std::vector<std::optional<std::uint64_t>>, std::vector<std::optional<std::uint64_t>>>& v) {
+        for (std::size_t i = 0; i < count; ++i) {
+            v.second[i] = v.first[i];
+        }
+    });
+}
+
+/**
+ * Runs the benchmarks of the B+tree against the @c std::map .
+ *
+ * @param r the runner
+ * @param count the amount of pairs
+ */
+static inline void run_btree(runner& r, std::size_t count) {
+    using tree     = dc4c::btree_benchmark;
+    using standard = std::map<std::uint64_t, double>;
+    using pairs    = dc4c::vector_benchmark;
+
+    const auto elements = make_elements<8>(count);
+    auto sorted = pairs();
+    for (const auto& e : elements) {
+        sorted.push_back(make_pair_benchmark(e.key, static_cast<double>(e.key)));
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const pair_benchmark_t& lhs, const pair_benchmark_t& rhs) {
+        return lhs.first < rhs.first;
+    });
+    const auto size = sizeof(std::uint64_t) + sizeof(double);
+    const auto make_map = [&] {
+        auto toReturn = standard();
+        for (const auto& p : sorted) {
+            toReturn.emplace_hint(toReturn.end(), p.first, p.second);
+        }
+        return toReturn;
+    };
+
+    r.measure("map_insert", "dc4c", size, count, count, [] { return tree(); }, [&](tree& t) {
+        for (const auto& e : elements) {
+            t.insert(e.key, static_cast<double>(e.key));
+        }
+    });
+    r.measure("map_insert", "std", size, count, count, [] { return standard(); }, [&](standard& m) {
+        for (const auto& e : elements) {
+            m.emplace(e.key, static_cast<double>(e.key));
+        }
+    });
+
+    r.measure("map_find", "dc4c", size, count, count, [&] {
+        auto toReturn = tree();
+        toReturn.bulk_load(sorted);
+        return toReturn;
+    }, [&](tree& t) {
+        std::size_t found = 0;
+        for (const auto& e : elements) {
+            found += t.find(e.key) != nullptr;
+        }
+        keep(found);
+    });
+    r.measure("map_find", "std", size, count, count, make_map, [&](standard& m) {
+        std::size_t found = 0;
+        for (const auto& e : elements) {
+            found += m.find(e.key) != m.end();
+        }
+        keep(found);
+    });
+
+    r.measure("map_iterate", "dc4c", size, count, count, [&] {
+        auto toReturn = tree();
+        toReturn.bulk_load(sorted);
+        return toReturn;
+    }, [](tree& t) {
+        double sum = 0;
+        btree_forEach(&t.data(), key, value, {
+            sum += *value;
+        });
+        keep(sum);
+    });
+    r.measure("map_iterate", "std", size, count, count, make_map, [](standard& m) {
+        double sum = 0;
+        for (const auto& p : m) {
+            sum += p.second;
+        }
+        keep(sum);
+    });
+
+    r.measure("map_bulk_load", "dc4c", size, count, count, [] { return tree(); }, [&](tree& t) {
+        t.bulk_load(sorted);
+    });
+    r.measure("map_bulk_load", "std", size, count, count, [] { return standard(); }, [&](standard& m) {
+        for (const auto& p : sorted) {
+            m.emplace_hint(m.end(), p.first, p.second);
+        }
+    });
+}
+
+/**
+ * Runs the benchmarks of a pipeline filtering and transforming the elements of
+ * a vector against the same steps building temporary @c std::vector s.
+ *
+ * @param r the runner
+ * @param count the amount of elements
+ */
+static inline void run_pipeline(runner& r, std::size_t count) {
+    using keys     = dc4c::vector_key;
+    using reals    = dc4c::vector_real;
+    using standard = std::vector<std::uint64_t>;
+
+    const auto elements = make_elements<8>(count);
+    auto source = keys();
+    for (const auto& e : elements) {
+        source.push_back(e.key);
+    }
+    const auto standardSource = standard(source.begin(), source.end());
+    const auto odd   = [](std::uint64_t key) { return (key & 1) != 0; };
+    const auto scale = [](std::uint64_t key) { return static_cast<double>(key >> 11) * 0.5; };
+    const auto small = [](double value) { return value < 1e15; };
+
+    r.measure("pipeline", "dc4c", sizeof(std::uint64_t), count, count, [] { return reals(); }, [&](reals& out) {
+        source | dc4c::filter(odd) | dc4c::map(scale) | dc4c::filter(small) | dc4c::into(out);
+        keep(out.size());
+    });
+    r.measure("pipeline", "std", sizeof(std::uint64_t), count, count, [] { return std::vector<double>(); },
+              [&](std::vector<double>& out) {
+        auto filtered = standard();
+        std::copy_if(standardSource.begin(), standardSource.end(), std::back_inserter(filtered), odd);
+        auto scaled = std::vector<double>(filtered.size());
+        std::transform(filtered.begin(), filtered.end(), scaled.begin(), scale);
+        std::copy_if(scaled.begin(), scaled.end(), std::back_inserter(out), small);
+        keep(out.size());
+    });
+}
+
+/**
+ * Runs the benchmarks of gathering the shards of a sharded vector against
+ * appending per thread @c std::vector s one after the other.
+ *
+ * @param r the runner
+ * @param count the amount of elements
+ */
+static inline void run_sharded(runner& r, std::size_t count) {
+    using sharded  = dc4c::sharded_vector_key;
+    using standard = std::vector<std::vector<std::uint64_t>>;
+
+    const std::size_t shards  = 8;
+    const std::size_t threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    const auto elements = make_elements<8>(count);
+    const auto make_sharded = [&] {
+        auto toReturn = std::unique_ptr<sharded>(new sharded(shards));
+        for (std::size_t i = 0; i < count; ++i) {
+            toReturn->push_back(i % shards, elements[i].key);
+        }
+        return toReturn;
+    };
+    const auto make_standard = [&] {
+        auto toReturn = standard(shards);
+        for (std::size_t i = 0; i < count; ++i) {
+            toReturn[i % shards].push_back(elements[i].key);
+        }
+        return toReturn;
+    };
+
+    r.measure("gather", "dc4c", sizeof(std::uint64_t), count, count, make_sharded, [&](std::unique_ptr<sharded>& s) {
+        keep(s->gather(threads).size());
+    });
+    r.measure("gather", "std", sizeof(std::uint64_t), count, count, make_standard, [](standard& s) {
+        auto gathered = std::vector<std::uint64_t>();
+        for (const auto& shard : s) {
+            gathered.insert(gathered.end(), shard.begin(), shard.end());
+        }
+        keep(gathered.size());
+    });
+
+    r.measure("gather_sorted", "dc4c", sizeof(std::uint64_t), count, count, make_sharded,
+              [&](std::unique_ptr<sharded>& s) {
+        keep(s->gather_sorted(threads, compare_key).size());
+    });
+    r.measure("gather_sorted", "std", sizeof(std::uint64_t), count, count, make_standard, [](standard& s) {
+        auto gathered = std::vector<std::uint64_t>();
+        for (const auto& shard : s) {
+            gathered.insert(gathered.end(), shard.begin(), shard.end());
+        }
+        std::sort(gathered.begin(), gathered.end());
+        keep(gathered.size());
+    });
+}
+
+/**
+ * Parses the given comma separated list of sizes.
+ *
+ * @param list the list
+ * @return the parsed sizes
+ */
+static inline auto parse_sizes(const char* list) -> std::vector<std::size_t> {
+    auto toReturn = std::vector<std::size_t>();
+    while (*list != '\0') {
+        char* end;
+        toReturn.push_back(std::strtoull(list, &end, 10));
+        list = *end == ',' ? end + 1 : end;
+        if (end == list && *end != '\0') break;
+    }
+    return toReturn;
+}
+
+/**
+ * Prints the usage of the benchmark executable.
+ *
+ * @param name the name of the executable
+ */
+static inline void print_usage(const char* name) {
+    std::fprintf(stderr, "Usage: %s [--json <file>] [--sizes <n,...>] [--repetitions <n>] [--filter <name>]\n"
+                         "  --json         writes the results into the given file instead of stdout\n"
+                         "  --sizes        the element counts to sweep, default 1000,100000,1000000\n"
+                         "  --repetitions  the repetitions of each benchmark, default 5\n"
+                         "  --filter       only runs the benchmarks whose name contains the given text\n", name);
+}
+}
+}
+
+int main(int argc, char** argv) {
+    using namespace dc4c::benchmarks;
+
+    const char* json        = nullptr;
+    const char* filter      = "";
+    auto        sizes       = std::vector<std::size_t> { 1000, 100000, 1000000 };
+    std::size_t repetitions = 5;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 < argc && std::strcmp(argv[i], "--json") == 0) {
+            json = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--sizes") == 0) {
+            sizes = parse_sizes(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--repetitions") == 0) {
+            repetitions = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--filter") == 0) {
+            filter = argv[++i];
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto r = runner(repetitions, filter);
+    for (const auto count : sizes) {
+        run_vector<8>(r, count);
+        run_vector<64>(r, count);
+        run_vector<256>(r, count);
+        run_conversions(r, count);
+        run_btree(r, count);
+        run_pipeline(r, count);
+        run_sharded(r, count);
+    }
+
+    std::FILE* stream = json == nullptr ? stdout : std::fopen(json, "w");
+    if (stream == nullptr) {
+        std::perror(json);
+        return EXIT_FAILURE;
+    }
+    r.write_json(stream);
+    if (stream != stdout) {
+        std::fclose(stream);
+    }
+}
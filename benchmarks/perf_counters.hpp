@@ -0,0 +1,165 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef __DC4C_benchmarks_perf_counters_hpp
+#define __DC4C_benchmarks_perf_counters_hpp
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace dc4c {
+namespace benchmarks {
+/**
+ * @brief This class reads the hardware counters of the calling thread.
+ *
+ * The counters are read using @c perf_event_open on Linux. If they are not
+ * available, for example because of the @c perf_event_paranoid setting, the
+ * counters are reported as unavailable and the benchmarks run nonetheless.
+ */
+class perf_counters {
+public:
+    /** The amount of measured hardware counters. */
+    static constexpr std::size_t count = 4;
+
+    /** The names of the hardware counters. */
+    static constexpr std::array<const char*, count> names = {
+        "cycles", "instructions", "cache_misses", "branch_misses"
+    };
+
+    /** The values of one measurement. */
+    using values = std::array<std::uint64_t, count>;
+
+private:
+    /** The file descriptors of the counters, the first one leads the group. */
+    std::array<int, count> fds;
+
+#ifdef __linux__
+    /**
+     * Opens the given hardware counter.
+     *
+     * @param config the hardware counter
+     * @param group the file descriptor of the group leader or @c -1
+     * @return the file descriptor or @c -1 if not available
+     */
+    static inline auto open(std::uint64_t config, int group) -> int {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.type           = PERF_TYPE_HARDWARE;
+        attributes.size           = sizeof(attributes);
+        attributes.config         = config;
+        attributes.disabled       = group == -1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+        attributes.read_format    = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group, 0));
+    }
+#endif
+
+public:
+    inline perf_counters() {
+        fds.fill(-1);
+#ifdef __linux__
+        const std::array<std::uint64_t, count> configs = {
+            PERF_COUNT_HW_CPU_CYCLES,   PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+        };
+        for (std::size_t i = 0; i < count; ++i) {
+            fds[i] = open(configs[i], fds[0]);
+            if (fds[i] < 0) {
+                close();
+                return;
+            }
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters&) = delete;
+
+    inline ~perf_counters() {
+        close();
+    }
+
+    auto operator=(const perf_counters&) -> perf_counters& = delete;
+
+    /**
+     * Returns whether the hardware counters are available.
+     *
+     * @return whether the counters can be read
+     */
+    inline auto available() const noexcept -> bool {
+        return fds[0] >= 0;
+    }
+
+    /**
+     * Resets and starts the hardware counters.
+     */
+    inline void start() noexcept {
+#ifdef __linux__
+        if (available()) {
+            ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    /**
+     * Stops the hardware counters and returns their values.
+     *
+     * @return the counted values, zero if not available
+     */
+    inline auto stop() noexcept -> values {
+        values toReturn {};
+#ifdef __linux__
+        if (available()) {
+            ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            std::array<std::uint64_t, count + 1> buffer {};
+            if (::read(fds[0], buffer.data(), sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer))) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    toReturn[i] = buffer[i + 1];
+                }
+            }
+        }
+#endif
+        return toReturn;
+    }
+
+private:
+    /**
+     * Closes all opened hardware counters.
+     */
+    inline void close() noexcept {
+#ifdef __linux__
+        for (auto& fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+#endif
+    }
+};
+}
+}
+
+#endif /* __DC4C_benchmarks_perf_counters_hpp */
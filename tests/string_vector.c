@@ -0,0 +1,71 @@
+/*
+ * DC4C - Standard data containers for C
+ *
+ * Written in 2023 - 2025 by mhahnFr
+ *
+ * This file is part of DC4C.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with DC4C,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#undef NDEBUG
+
+#include <string_vector.h>
+
+#include <assert.h>
+#include <string.h>
+
+/**
+ * Appends strings stored in the string vector itself, so that the arena has to
+ * grow while their characters are copied.
+ */
+static void test_push_back_stored(void) {
+    char string[200];
+    memset(string, 'a', sizeof(string) - 1);
+    string[sizeof(string) - 1] = '\0';
+
+    string_vector_t strings = string_vector_initializer;
+    assert(string_vector_push_back(&strings, string));
+    for (size_t i = 0; i < 8; ++i) {
+        const size_t arenaCap = strings.arenaCap;
+        assert(string_vector_push_back(&strings, string_vector_get(&strings, i)));
+        assert(i > 0 || strings.arenaCap > arenaCap);
+    }
+    assert(string_vector_push_back_n(&strings, string_vector_get(&strings, 0) + 10, 5));
+
+    assert(string_vector_size(&strings) == 10);
+    for (size_t i = 0; i < 9; ++i) {
+        assert(string_vector_length(&strings, i) == sizeof(string) - 1);
+        assert(strcmp(string_vector_get(&strings, i), string) == 0);
+    }
+    assert(strcmp(string_vector_get(&strings, 9), "aaaaa") == 0);
+    string_vector_destroy(&strings);
+}
+
+/**
+ * Interns a part of a stored string, so that the arena has to grow while its
+ * characters are copied.
+ */
+static void test_intern_stored(void) {
+    char string[200];
+    memset(string, 'b', sizeof(string) - 1);
+    string[sizeof(string) - 1] = '\0';
+
+    string_vector_t strings = string_vector_initializer;
+    assert(string_vector_intern(&strings, string) == 0);
+    assert(string_vector_intern(&strings, string_vector_get(&strings, 0)) == 0);
+    assert(string_vector_intern(&strings, string_vector_get(&strings, 0) + 1) == 1);
+    assert(string_vector_length(&strings, 1) == sizeof(string) - 2);
+    assert(strcmp(string_vector_get(&strings, 1), string + 1) == 0);
+    string_vector_destroy(&strings);
+}
+
+int main(void) {
+    test_push_back_stored();
+    test_intern_stored();
+}